@@ -6,10 +6,19 @@
 //================================================================
 
 #include "Background.h"
+#include "StateStream.h"
 
 // CONSTRUCTOR
 Background::Background() : offset{0} {}
 
+void Background::saveState(StateWriter& out) const {
+    out.put(offset);
+}
+
+void Background::loadState(StateReader& in) {
+    in.get(offset);
+}
+
 // UPDATE
 void Background::update(int playerSpeed) {
     offset -= playerSpeed;
@@ -10,6 +10,9 @@
 
 #include "Const.h"
 
+class StateWriter;  // Forward declaration
+class StateReader;  // Forward declaration
+
 class Background {
 private:
     int offset;     // Current animation offset for dashed lines
@@ -46,6 +49,15 @@ public:
      * Post-condition: No state change
      */
     int getOffset() const { return offset; }
+
+    /*
+     * Description: Save or restore the animation offset
+     * Return: void
+     * Pre-condition: in holds what saveState wrote
+     * Post-condition: offset written to out, or read back from in
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
 };
 
 #endif /* Background_h */
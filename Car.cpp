@@ -6,11 +6,15 @@
 //=================================================================
 
 #include "Car.h"
+#include "StateStream.h"
 #include "Utils.h"
 #include "Obstacle.h"
+#include "EntityStore.h"
+#include "SpriteMask.h"
 #include <algorithm>
 #include <cstdlib>
 #include <cmath>
+#include <map>
 #include <vector>
 
 // BASE CAR CLASS IMPLEMENTATION
@@ -23,6 +27,22 @@ Car::Car(int x, int y, color carColor, int speed)
       _speed{speed}
 {}
 
+void Car::saveState(StateWriter& out) const {
+    out.put(_loc);
+    out.put(_prvLoc);
+    out.put(_color);
+    out.put(_size);
+    out.put(_speed);
+}
+
+void Car::loadState(StateReader& in) {
+    in.get(_loc);
+    in.get(_prvLoc);
+    in.get(_color);
+    in.get(_size);
+    in.get(_speed);
+}
+
 void Car::draw(SDL_Plotter& g) {
     int wheelSize = _size / 5 + 2;
 
@@ -56,6 +76,22 @@ int Car::getSpeed() const {
     return _speed;
 }
 
+const SpriteMask& Car::getMask(int size) {
+    static thread_local std::map<int, SpriteMask> masks;
+    std::map<int, SpriteMask>::iterator found = masks.find(size);
+    if(found != masks.end()) return found->second;
+
+    // SAME RECTANGLES AS draw(), RELATIVE TO THE TOP-LEFT CORNER
+    SpriteMask mask(size, size);
+    int wheelSize = size / 5 + 2;
+    mask.fillRect(0, 0, size, size);
+    mask.fillRect(0, 0, wheelSize, wheelSize);
+    mask.fillRect(size - wheelSize, 0, wheelSize, wheelSize);
+    mask.fillRect(0, size - wheelSize, wheelSize, wheelSize);
+    mask.fillRect(size - wheelSize, size - wheelSize, wheelSize, wheelSize);
+    return masks[size] = mask;
+}
+
 // PLAYER CAR CLASS IMPLEMENTATION
 
 PlayerCar::PlayerCar(int x, int y, color carColor)
@@ -94,6 +130,10 @@ void PlayerCar::move(char direction) {
     }
 }
 
+void PlayerCar::beginTick() {
+    _prvLoc = _loc;
+}
+
 void PlayerCar::update(int bgOffset) {
     (void)bgOffset; // no continuous movement; input handled in main loop
 }
@@ -109,132 +149,19 @@ void PlayerCar::setSpeed(int speed) {
     _speed = std::min(std::max(speed, MIN_SPEED), MAX_SPEED);
 }
 
-// AI CAR CLASS IMPLEMENTATION
+// AI CAR VIEW IMPLEMENTATION
 
-AICar::AICar(int startX, int startY, color carColor, int speed)
-    : Car(startX, startY, carColor, speed),
-      _targetLane{0},
-      _laneChangeTimer{0},
-      _laneChangeDelay{AI_LANE_CHANGE_DELAY},
-      _changingLane{false}
+AICar::AICar(EntityStore& store, int index)
+    : Car(store.getAIX()[index], store.getAIY()[index], store.getAIColor(index),
+          store.getAISpeed()[index]),
+      _store{&store},
+      _index{index},
+      _targetLane{store.getAILane()[index]}
 {
-    initializeLanes();
-    _targetLane = static_cast<int>(selectRandomLane());
-    _loc.x = getLanePosition(static_cast<AILane>(_targetLane));
-}
-
-void AICar::initializeLanes() {
-    _leftLane   = LEFT_LANE_X;
-    _centerLane = CENTER_LANE_X;
-    _rightLane  = RIGHT_LANE_X;
-}
-
-int AICar::getLanePosition(AILane lane) {
-    switch(lane) {
-        case LEFT_LANE:   return _leftLane;
-        case CENTER_LANE: return _centerLane;
-        case RIGHT_LANE:  return _rightLane;
-        default:          return _centerLane;
-    }
-}
-
-AILane AICar::selectRandomLane() {
-    int random = std::rand() % 3;
-    return static_cast<AILane>(random);
-}
-
-void AICar::updateLaneChange() {
-    int target = getLanePosition(static_cast<AILane>(_targetLane));
-
-    if(_loc.x < target - LANE_CHANGE_THRESHOLD) {
-        _loc.x += LANE_CHANGE_STEP;
-        _changingLane = true;
-    }
-    else if(_loc.x > target + LANE_CHANGE_THRESHOLD) {
-        _loc.x -= LANE_CHANGE_STEP;
-        _changingLane = true;
-    }
-    else {
-        _loc.x = target;
-        _changingLane = false;
-    }
-}
-
-bool AICar::isLaneBlocked(AILane lane, const std::vector<Obstacle>& obstacles) const {
-    int laneX = const_cast<AICar*>(this)->getLanePosition(lane);
-
-    for (const auto& obs : obstacles) {
-        point oLoc = obs.getLocation();
-        int   oSize = obs.getSize();
-
-        // Same lane horizontally?
-        if (std::abs(oLoc.x - laneX) <= oSize / 2) {
-            // Ahead of AI within danger distance
-            if (oLoc.y > _loc.y && oLoc.y - _loc.y < 150) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-void AICar::update(int bgOffset, const std::vector<Obstacle>& obstacles) {
-    (void)bgOffset; // not used currently
-
-    _prvLoc.x = _loc.x;
-    _prvLoc.y = _loc.y;
-
-    _loc.y += _speed;
-    _laneChangeTimer++;
-
-    if(!_changingLane && _laneChangeTimer >= _laneChangeDelay) {
-        _laneChangeTimer = 0;
-
-        AILane currentLane = static_cast<AILane>(_targetLane);
-
-        bool currentBlocked = isLaneBlocked(currentLane, obstacles);
-        bool leftBlocked    = isLaneBlocked(LEFT_LANE,   obstacles);
-        bool centerBlocked  = isLaneBlocked(CENTER_LANE, obstacles);
-        bool rightBlocked   = isLaneBlocked(RIGHT_LANE,  obstacles);
-
-        if (currentBlocked) {
-            std::vector<AILane> candidates;
-            if (!leftBlocked)   candidates.push_back(LEFT_LANE);
-            if (!centerBlocked) candidates.push_back(CENTER_LANE);
-            if (!rightBlocked)  candidates.push_back(RIGHT_LANE);
-
-            if (!candidates.empty()) {
-                AILane newLane = candidates[std::rand() % candidates.size()];
-                _targetLane = static_cast<int>(newLane);
-            }
-        } else {
-            int decision = std::rand() % 100;
-            if (decision < AI_LANE_CHANGE_THRESHOLD) {
-                std::vector<AILane> candidates = { LEFT_LANE, CENTER_LANE, RIGHT_LANE };
-
-                candidates.erase(
-                    std::remove_if(candidates.begin(), candidates.end(),
-                                   [&](AILane l){
-                                       return l == currentLane || isLaneBlocked(l, obstacles);
-                                   }),
-                    candidates.end()
-                );
-
-                if (!candidates.empty()) {
-                    AILane newLane = candidates[std::rand() % candidates.size()];
-                    _targetLane = static_cast<int>(newLane);
-                }
-            }
-        }
-    }
-
-    updateLaneChange();
+    _prvLoc = point(store.getAIPrvX()[index], store.getAIPrvY()[index]);
 }
 
 void AICar::respawn() {
-    _targetLane = static_cast<int>(selectRandomLane());
-    _loc.x = getLanePosition(static_cast<AILane>(_targetLane));
-    _loc.y = -_size - (std::rand() % AI_SPAWN_Y_RANDOM_RANGE);
-    _prvLoc = _loc;
-    _laneChangeTimer = 0;
+    _store->respawnAICar(_index);
+    *this = AICar(*_store, _index);
 }
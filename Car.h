@@ -12,7 +12,11 @@
 #include "Const.h"
 #include <vector>
 
-class Obstacle;  // Forward declaration
+class Obstacle;     // Forward declaration
+class EntityStore;  // Forward declaration
+class SpriteMask;   // Forward declaration
+class StateWriter;  // Forward declaration
+class StateReader;  // Forward declaration
 
 // BASE CAR CLASS
 
@@ -73,6 +77,15 @@ public:
      */
     virtual void respawn() = 0;
 
+    /*
+     * Description: Save or restore position, previous position, color, size and speed
+     * Return: void
+     * Pre-condition: in holds what saveState wrote
+     * Post-condition: Fields written to out, or read back from in
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
+
     /*
      * Description: Get car location
      * Return: point - current position
@@ -104,6 +117,15 @@ public:
      * Post-condition: No state change
      */
     int getSpeed() const;
+
+    /*
+     * Description: Collision mask of a car, built from the rectangles draw() fills
+     * Return: const SpriteMask& - size x size mask; its top-left pixel is
+     *         (x - size / 2, y - size / 2) for a car centered at (x, y)
+     * Pre-condition: size > 0
+     * Post-condition: Mask built on first use of each size in each thread
+     */
+    static const SpriteMask& getMask(int size);
 };
 
 // PLAYER CAR CLASS - KEYBOARD CONTROLLED
@@ -129,6 +151,15 @@ public:
      */
     void move(char direction);
 
+    /*
+     * Description: Start a tick: the current location becomes the
+     *              previous one, so the tick's motion can be swept
+     * Return: void
+     * Pre-condition: Called once per tick, before move()
+     * Post-condition: _prvLoc == _loc
+     */
+    void beginTick();
+
     /*
      * Description: Update car state each frame (no continuous movement)
      * Return: void
@@ -154,77 +185,25 @@ public:
     void setSpeed(int speed);
 };
 
-// AI CAR CLASS - AUTONOMOUS LANE CHANGING
-
+// AI CAR VIEW - ONE CAR IN AN ENTITY STORE
 class AICar : public Car {
 private:
-    int  _targetLane;        // Lane index car is moving toward
-    int  _laneChangeTimer;   // Counter for lane change decisions
-    int  _laneChangeDelay;   // Frames between potential lane changes
-    bool _changingLane;      // Whether currently shifting between lanes
-    int  _leftLane;          // X position of left lane
-    int  _centerLane;        // X position of center lane
-    int  _rightLane;         // X position of right lane
-
-    /*
-     * Description: Initialize lane x-positions for AI
-     * Return: void
-     * Pre-condition: Road lane constants are defined
-     * Post-condition: Lane x values stored in member variables
-     */
-    void initializeLanes();
-
-    /*
-     * Description: Get x-position of a given lane
-     * Return: int - x coordinate for specified lane
-     * Pre-condition: lane is valid AILane value
-     * Post-condition: No state change
-     */
-    int getLanePosition(AILane lane);
-
-    /*
-     * Description: Smoothly move AI car toward target lane x position
-     * Return: void
-     * Pre-condition: _targetLane set to desired lane index
-     * Post-condition: _loc.x moved toward target, _changingLane updated
-     */
-    void updateLaneChange();
-
-    /*
-     * Description: Select a random lane enum (LEFT, CENTER, RIGHT)
-     * Return: AILane - randomly chosen lane
-     * Pre-condition: None
-     * Post-condition: No state change
-     */
-    AILane selectRandomLane();
-
-    /*
-     * Description: Check if a lane has an obstacle ahead of the AI car
-     * Return: bool - true if lane is blocked, false otherwise
-     * Pre-condition: obstacles vector is valid
-     * Post-condition: No state change
-     */
-    bool isLaneBlocked(AILane lane, const std::vector<Obstacle>& obstacles) const;
+    EntityStore* _store;     // Store holding the car's fields
+    int          _index;     // Car's entry in the store
+    int          _targetLane; // Lane the car is steering toward
 
 public:
     /*
-     * Description: Initialize AI car at position w/ color & speed
+     * Description: View one AI car in an entity store
      * Return: None (constructor)
-     * Pre-condition: startX, startY within valid bounds
-     * Post-condition: AI car created w/ random lane selected
+     * Pre-condition: index < store.getAICount()
+     * Post-condition: View holds the car's current fields
      */
-    AICar(int startX, int startY, color carColor, int speed = CAR_START_SPEED);
+    AICar(EntityStore& store, int index);
 
     /*
-     * Description: Update AI car position and lane behavior with obstacle awareness
-     * Return: void
-     * Pre-condition: bgOffset and obstacles are valid
-     * Post-condition: Car moved down, lane change logic evaluated and applied
-     */
-    void update(int bgOffset, const std::vector<Obstacle>& obstacles);
-
-    /*
-     * Description: Override base update to satisfy interface (unused)
+     * Description: Satisfy the Car interface; AI cars are updated all at
+     *              once by EntityStore::updateAICars
      * Return: void
      * Pre-condition: bgOffset is valid
      * Post-condition: No state change
@@ -234,10 +213,18 @@ public:
     /*
      * Description: Reposition AI car at top of screen w/ new random lane
      * Return: void
-     * Pre-condition: None
-     * Post-condition: Car repositioned at top with random lane and timer reset
+     * Pre-condition: Store still exists
+     * Post-condition: Store entry and view respawned
      */
     void respawn() override;
+
+    /*
+     * Description: Get the lane the car is steering toward
+     * Return: int - AILane value
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getTargetLane() const { return _targetLane; }
 };
 
 #endif /* SRC_CAR_H_ */
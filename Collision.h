@@ -10,6 +10,27 @@
 
 #include "Car.h"
 #include "Obstacle.h"
+#include "EntityStore.h"
+#include "SpriteMask.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+// MASK BIT OF EACH LANE IN A BLOCK (a table, so the OR-reduction vectorizes)
+const uint32_t LANE_BIT[COLLISION_LANES] = {
+    1u << 0,  1u << 1,  1u << 2,  1u << 3,  1u << 4,  1u << 5,  1u << 6,  1u << 7,
+    1u << 8,  1u << 9,  1u << 10, 1u << 11, 1u << 12, 1u << 13, 1u << 14, 1u << 15
+};
+
+// RESULT OF ONE BATCHED NARROW-PHASE TEST
+struct CollisionHits {
+    uint64_t      mask;    // Bit c set if candidate c hit
+    int           first;   // First candidate that hit, -1 if none
+    CollisionKind kind;    // Kind of the first hit (NO_COLLISION if none)
+    int           time;    // Time of impact of the first hit within the tick
+                           // (0 = start, COLLISION_TIME_ONE = end, and
+                           // COLLISION_TIME_ONE if none)
+};
 
 class Collision {
 public:
@@ -22,15 +43,7 @@ public:
     static bool checkCarCollision(const Car& player, const AICar& ai) {
         point playerLoc = player.getLoc();
         point aiLoc = ai.getLoc();
-        int playerSize = player.getSize();
-        int aiSize = ai.getSize();
-
-        // DISTANCE BETWEEN CETNERS
-        int dx = playerLoc.x - aiLoc.x;
-        int dy = playerLoc.y - aiLoc.y;
-        float distance = sqrt(dx * dx + dy * dy);
-
-        return distance < (playerSize / 2 + aiSize / 2);
+        return circleHit(playerLoc.x, playerLoc.y, player.getSize() / 2, aiLoc.x, aiLoc.y, ai.getSize()) != 0;
     }
 
     /*
@@ -44,34 +57,393 @@ public:
     }
 
     /*
-     * Description: Check all collisions in the game
+     * Description: Test a player against up to COLLISION_BATCH car circles
+     *              (circles) or obstacle boxes (boxes), COLLISION_LANES
+     *              candidates per block
+     * Return: CollisionHits - hit mask, first hit, AI_COLLISION or
+     *         OBSTACLE_COLLISION
+     * Pre-condition: 0 <= count <= COLLISION_BATCH; arrays hold count
+     *                entries; sizes below 2896 pixels
+     * Post-condition: No state change; same results as checkCarCollision
+     *                 and the box stage of Obstacle::collidesWith
+     */
+    static CollisionHits checkCircles(point center, int size, const int* x, const int* y,
+                                      const int* sizes, int count) {
+        const int half = size / 2;
+        uint64_t mask = 0;
+        int base = 0;
+        for(; base + COLLISION_LANES <= count; base += COLLISION_LANES) {
+            uint32_t bits = 0;
+            for(int c = 0; c < COLLISION_LANES; c++) {
+                bits |= -static_cast<uint32_t>(circleHit(center.x, center.y, half, x[base + c], y[base + c], sizes[base + c])) & LANE_BIT[c];
+            }
+            mask |= static_cast<uint64_t>(bits) << base;
+        }
+        for(; base < count; base++) {
+            mask |= static_cast<uint64_t>(circleHit(center.x, center.y, half, x[base], y[base], sizes[base])) << base;
+        }
+        return result(mask, AI_COLLISION);
+    }
+    static CollisionHits checkBoxes(point center, int size, const int* x, const int* y,
+                                    const int* sizes, const Uint8* active, int count) {
+        const int half = size / 2;
+        uint64_t mask = 0;
+        int base = 0;
+        for(; base + COLLISION_LANES <= count; base += COLLISION_LANES) {
+            uint32_t bits = 0;
+            for(int c = 0; c < COLLISION_LANES; c++) {
+                bits |= -static_cast<uint32_t>(boxHit(center.x, center.y, half, x[base + c], y[base + c], sizes[base + c], active[base + c])) & LANE_BIT[c];
+            }
+            mask |= static_cast<uint64_t>(bits) << base;
+        }
+        for(; base < count; base++) {
+            mask |= static_cast<uint64_t>(boxHit(center.x, center.y, half, x[base], y[base], sizes[base], active[base])) << base;
+        }
+        return result(mask, OBSTACLE_COLLISION);
+    }
+
+    /*
+     * Description: Swept versions of checkCircles/checkBoxes: the player
+     *              moves from -> to while candidate c moves (x0, y0) ->
+     *              (x1, y1), both in a straight line over one tick. The
+     *              block kernels above run first at the end of the tick
+     *              with each reach widened by the candidate's relative
+     *              move; the exact swept test runs only on their hits
+     * Return: CollisionHits - hit mask, earliest hit (ties go to the lower
+     *         candidate), its kind, and its time of impact in fixed point
+     * Pre-condition: 0 <= count <= COLLISION_BATCH; arrays hold count
+     *                entries; reach plus the relative move (|x| + |y|)
+     *                below 2896 pixels
+     * Post-condition: No state change; hit decided in integer math, so a
+     *                 candidate overlapping at the end of the tick always hits
+     */
+    static CollisionHits checkSweptCircles(point from, point to, int size,
+                                           const int* x0, const int* y0, const int* x1, const int* y1,
+                                           const int* sizes, int count) {
+        // WIDEN - a path that comes within reach ends within reach plus
+        // its length, and |v| <= |vx| + |vy|
+        int vx[COLLISION_BATCH], vy[COLLISION_BATCH], widened[COLLISION_BATCH];
+        for(int c = 0; c < count; c++) {
+            vx[c] = (to.x - from.x) - (x1[c] - x0[c]);
+            vy[c] = (to.y - from.y) - (y1[c] - y0[c]);
+            widened[c] = sizes[c] + 2 * (std::abs(vx[c]) + std::abs(vy[c]));
+        }
+        uint64_t mask = checkCircles(to, size, x1, y1, widened, count).mask;
+
+        CollisionHits hits = { 0, -1, NO_COLLISION, COLLISION_TIME_ONE };
+        for(int c = 0; mask != 0; c++, mask >>= 1) {
+            int time;
+            if((mask & 1) &&
+               sweptCircleHit(from.x - x0[c], from.y - y0[c], vx[c], vy[c], size / 2 + sizes[c] / 2, time)) {
+                addSweptHit(hits, c, time, AI_COLLISION);
+            }
+        }
+        return hits;
+    }
+    static CollisionHits checkSweptBoxes(point from, point to, int size,
+                                         const int* x0, const int* y0, const int* x1, const int* y1,
+                                         const int* sizes, const Uint8* active, int count) {
+        // WIDEN - each axis of a path that overlaps ends within reach plus
+        // that axis's move
+        int vx[COLLISION_BATCH], vy[COLLISION_BATCH], widened[COLLISION_BATCH];
+        for(int c = 0; c < count; c++) {
+            vx[c] = (to.x - from.x) - (x1[c] - x0[c]);
+            vy[c] = (to.y - from.y) - (y1[c] - y0[c]);
+            widened[c] = sizes[c] + 2 * std::max(std::abs(vx[c]), std::abs(vy[c]));
+        }
+        uint64_t mask = checkBoxes(to, size, x1, y1, widened, active, count).mask;
+
+        CollisionHits hits = { 0, -1, NO_COLLISION, COLLISION_TIME_ONE };
+        for(int c = 0; mask != 0; c++, mask >>= 1) {
+            int time;
+            if((mask & 1) &&
+               sweptBoxHit(from.x - x0[c], from.y - y0[c], vx[c], vy[c], size / 2 + sizes[c] / 2, time)) {
+                addSweptHit(hits, c, time, OBSTACLE_COLLISION);
+            }
+        }
+        return hits;
+    }
+
+    /*
+     * Description: Check all collisions in the game during the last tick
      * Return: void
-     * Pre-condition: player, aiCars, and obstacles are initialized
+     * Pre-condition: player and entities are initialized
      * Post-condition: hitAI and hitObstacle flags set based on collisions
      */
     static void checkAllCollisions(const Car& player,
-                                   vector<AICar>& aiCars,
-                                   vector<Obstacle>& obstacles,
+                                   const EntityStore& entities,
                                    bool& hitAI,
                                    bool& hitObstacle) {
-        hitAI = false;
-        hitObstacle = false;
-
-        // AI CAR COLLISION CHECK
-        for(auto& ai : aiCars) {
-            if(checkCarCollision(player, ai)) {
-                hitAI = true;
-                break;
+        point contact;
+        checkAllCollisions(player, entities, hitAI, hitObstacle, contact);
+    }
+
+    /*
+     * Description: Check all collisions along this tick's motion and
+     *              report where the earliest hit occurred
+     * Return: void
+     * Pre-condition: player and entities are initialized; previous
+     *                locations hold the start of the tick
+     * Post-condition: hitAI/hitObstacle set; contact = midpoint of the two
+     *                 bodies at the earliest time of impact
+     */
+    static void checkAllCollisions(const Car& player,
+                                   const EntityStore& entities,
+                                   bool& hitAI,
+                                   bool& hitObstacle,
+                                   point& contact) {
+        point from = player.getPrvLoc();
+        point to = player.getLoc();
+        int playerSize = player.getSize();
+        int half = playerSize / 2;
+        int left = std::min(from.x, to.x) - half, right = std::max(from.x, to.x) + half;
+        int top = std::min(from.y, to.y) - half, bottom = std::max(from.y, to.y) + half;
+        contact = to;
+
+        // AI CARS - candidates from the index gathered into contiguous
+        // batches and swept from their previous positions
+        const int* aiX = entities.getAIX();
+        const int* aiY = entities.getAIY();
+        const int* aiPrvX = entities.getAIPrvX();
+        const int* aiPrvY = entities.getAIPrvY();
+        CandidateBatch batch;
+        batch.count = 0;
+        SweptHit firstCar;
+        entities.queryAICars(left, right, top, bottom, [&](int i) {
+            batch.add(i, aiPrvX[i], aiPrvY[i], aiX[i], aiY[i], SIZE, 1);
+            if(batch.count == COLLISION_BATCH) {
+                batch.earliest(checkSweptCircles(from, to, playerSize, batch.x0, batch.y0, batch.x, batch.y, batch.size, batch.count), firstCar);
+            }
+            return false;
+        });
+        batch.earliest(checkSweptCircles(from, to, playerSize, batch.x0, batch.y0, batch.x, batch.y, batch.size, batch.count), firstCar);
+
+        // OBSTACLES - swept version of Obstacle::collidesWith: swept boxes,
+        // then the sprite masks for the candidates whose boxes met
+        const SpriteMask& playerMask = Car::getMask(playerSize);
+        const int* obsX = entities.getObstacleX();
+        const int* obsY = entities.getObstacleY();
+        const int* obsPrvY = entities.getObstaclePrvY();
+        const int* obsSize = entities.getObstacleSize();
+        const Uint8* active = entities.getObstacleActive();
+        SweptHit firstObstacle;
+        entities.queryObstacles(left, right, top, bottom, [&](int i) {
+            batch.add(i, obsX[i], obsPrvY[i], obsX[i], obsY[i], obsSize[i], active[i]);
+            if(batch.count == COLLISION_BATCH) {
+                batch.earliestSprite(checkSweptBoxes(from, to, playerSize, batch.x0, batch.y0, batch.x, batch.y, batch.size, batch.active, batch.count),
+                                     from, to, playerMask, firstObstacle);
             }
+            return false;
+        });
+        batch.earliestSprite(checkSweptBoxes(from, to, playerSize, batch.x0, batch.y0, batch.x, batch.y, batch.size, batch.active, batch.count),
+                             from, to, playerMask, firstObstacle);
+
+        // CONTACT - both bodies where the earliest hit happened (AI on ties)
+        hitAI = firstCar.id >= 0;
+        hitObstacle = firstObstacle.id >= 0;
+        if(hitAI && (!hitObstacle || firstCar.time <= firstObstacle.time)) {
+            int i = firstCar.id;
+            contact = midpoint(lerp(from, to, firstCar.time),
+                               lerp(point(aiPrvX[i], aiPrvY[i]), point(aiX[i], aiY[i]), firstCar.time));
+        }
+        else if(hitObstacle) {
+            int i = firstObstacle.id;
+            contact = midpoint(lerp(from, to, firstObstacle.time),
+                               lerp(point(obsX[i], obsPrvY[i]), point(obsX[i], obsY[i]), firstObstacle.time));
+        }
+    }
+
+private:
+    // EARLIEST HIT OF ONE KIND SO FAR
+    struct SweptHit {
+        int    id;      // Entity index, -1 if none
+        int    time;    // Time of impact within the tick (COLLISION_TIME_ONE = end)
+
+        SweptHit() : id{-1}, time{COLLISION_TIME_ONE} {}
+    };
+
+    // CANDIDATES COPIED OUT OF THE STORE FOR ONE BATCHED TEST
+    struct CandidateBatch {
+        int   id[COLLISION_BATCH];
+        int   x0[COLLISION_BATCH], y0[COLLISION_BATCH];   // Start of the tick
+        int   x[COLLISION_BATCH], y[COLLISION_BATCH];     // End of the tick
+        int   size[COLLISION_BATCH];
+        Uint8 active[COLLISION_BATCH];
+        int   count;
+
+        void add(int i, int px, int py, int cx, int cy, int csize, Uint8 cactive) {
+            id[count] = i;
+            x0[count] = px;
+            y0[count] = py;
+            x[count] = cx;
+            y[count] = cy;
+            size[count] = csize;
+            active[count] = cactive;
+            count++;
+        }
+
+        // Keep this batch's first hit if it is earlier than best; empties the batch
+        void earliest(CollisionHits hits, SweptHit& best) {
+            if(hits.first >= 0 && (best.id < 0 || hits.time < best.time)) {
+                best.id = id[hits.first];
+                best.time = hits.time;
+            }
+            count = 0;
         }
 
-        // OBSTACLE COLLISION CHECK
-        for(auto& obs : obstacles) {
-            if(checkObstacleCollision(player, obs)) {
-                hitObstacle = true;
-                break;
+        // Same for obstacles, after the cone masks confirm each box hit
+        void earliestSprite(CollisionHits boxes, point from, point to, const SpriteMask& playerMask, SweptHit& best) {
+            for(int c = 0; boxes.mask != 0; c++, boxes.mask >>= 1) {
+                int time;
+                if((boxes.mask & 1) &&
+                   sweptMaskHit(from, to, playerMask, point(x0[c], y0[c]), point(x[c], y[c]), Obstacle::getMask(size[c]), time) &&
+                   (best.id < 0 || time < best.time)) {
+                    best.id = id[c];
+                    best.time = time;
+                }
             }
+            count = 0;
         }
+    };
+
+    // CIRCLE TEST ON SQUARED DISTANCE - matches sqrt(dx*dx + dy*dy) < reach
+    // in float while reach < 2896; the axis checks come first so the
+    // (unsigned, wrapping) squares only matter when they are exact
+    static int circleHit(int cx, int cy, int half, int x, int y, int size) {
+        int reach = half + size / 2;
+        int dx = cx - x;
+        int dy = cy - y;
+        uint32_t distance2 = static_cast<uint32_t>(dx) * static_cast<uint32_t>(dx) +
+                             static_cast<uint32_t>(dy) * static_cast<uint32_t>(dy);
+        return (dx < reach) & (dx > -reach) & (dy < reach) & (dy > -reach) &
+               (distance2 < static_cast<uint32_t>(reach * reach));
+    }
+
+    // SWEPT CIRCLE TEST - relative offset d + t*v for t in [0, 1]; hit if
+    // |d + t*v| < reach anywhere on it. All integer: the hit is decided at
+    // the closest approach, the time is the first fixed-point step inside
+    static bool sweptCircleHit(int dx, int dy, int vx, int vy, int reach, int& time) {
+        const int64_t reach2 = static_cast<int64_t>(reach) * reach;
+        int64_t a = static_cast<int64_t>(vx) * vx + static_cast<int64_t>(vy) * vy;
+        int64_t b = static_cast<int64_t>(dx) * vx + static_cast<int64_t>(dy) * vy;
+        int64_t c = static_cast<int64_t>(dx) * dx + static_cast<int64_t>(dy) * dy - reach2;
+        if(c < 0) {
+            time = 0;
+            return true;
+        }
+        if(a == 0 || b >= 0) return false;                      // Not closing
+        if(-b >= a) {                                            // Closest at the end
+            int64_t ex = dx + vx, ey = dy + vy;
+            if(ex * ex + ey * ey >= reach2) return false;
+        }
+        else if(b * b <= a * c) {                                // Passes outside
+            return false;
+        }
+
+        // The distance shrinks until the closest approach, so binary search
+        // the steps before it for the first one inside
+        auto inside = [&](int64_t step) {
+            int64_t x = static_cast<int64_t>(dx) * COLLISION_TIME_ONE + step * vx;
+            int64_t y = static_cast<int64_t>(dy) * COLLISION_TIME_ONE + step * vy;
+            return x * x + y * y < reach2 * COLLISION_TIME_ONE * COLLISION_TIME_ONE;
+        };
+        int64_t low = 0, high = std::min<int64_t>(COLLISION_TIME_ONE, -b * COLLISION_TIME_ONE / a);
+        if(inside(high)) {
+            while(low < high) {
+                int64_t mid = (low + high) / 2;
+                if(inside(mid)) high = mid;
+                else low = mid + 1;
+            }
+        }
+        time = static_cast<int>(high);                           // Else a graze between steps
+        return true;
+    }
+
+    // SWEPT BOX TEST - hit if -reach < d + t*v < reach on both axes for some
+    // t in [0, 1]; each axis overlaps for an open interval of t, kept as
+    // exact fractions (positive denominators)
+    static bool sweptBoxHit(int dx, int dy, int vx, int vy, int reach, int& time) {
+        int64_t enter = -1, enterDen = 1, leave = 2, leaveDen = 1;
+        const int d[2] = { dx, dy }, v[2] = { vx, vy };
+        for(int axis = 0; axis < 2; axis++) {
+            if(v[axis] == 0) {
+                if(d[axis] <= -reach || d[axis] >= reach) return false;
+                continue;
+            }
+            int64_t den = std::abs(v[axis]);
+            int64_t in = v[axis] > 0 ? -reach - d[axis] : d[axis] - reach;
+            int64_t out = v[axis] > 0 ? reach - d[axis] : d[axis] + reach;
+            if(in * enterDen > enter * den) { enter = in; enterDen = den; }
+            if(out * leaveDen < leave * den) { leave = out; leaveDen = den; }
+        }
+        if(enter * leaveDen >= leave * enterDen || enter >= enterDen || leave <= 0) return false;
+        time = enter <= 0 ? 0 : static_cast<int>(enter * COLLISION_TIME_ONE / enterDen);
+        return true;
+    }
+
+    // PIXEL STAGE OF A SWEPT HIT - walk the relative motion one pixel at a
+    // time, testing the masks (top-left corners) at each offset; time is
+    // the first offset that overlaps
+    static bool sweptMaskHit(point from, point to, const SpriteMask& playerMask,
+                             point start, point end, const SpriteMask& mask, int& time) {
+        int pw = playerMask.getWidth() / 2, ph = playerMask.getHeight() / 2;
+        int mw = mask.getWidth() / 2, mh = mask.getHeight() / 2;
+        point r0((start.x - mw) - (from.x - pw), (start.y - mh) - (from.y - ph));
+        point r1((end.x - mw) - (to.x - pw), (end.y - mh) - (to.y - ph));
+        int steps = std::max(1, std::max(std::abs(r1.x - r0.x), std::abs(r1.y - r0.y)));
+        for(int s = 0; s <= steps; s++) {
+            int t = static_cast<int>(static_cast<int64_t>(s) * COLLISION_TIME_ONE / steps);
+            point r = lerp(r0, r1, t);
+            if(SpriteMask::overlaps(playerMask, 0, 0, mask, r.x, r.y)) {
+                time = t;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // RECORD A SWEPT HIT IF IT IS THE EARLIEST SO FAR
+    static void addSweptHit(CollisionHits& hits, int c, int time, CollisionKind kind) {
+        hits.mask |= static_cast<uint64_t>(1) << c;
+        if(hits.first < 0 || time < hits.time) {
+            hits.first = c;
+            hits.time = time;
+            hits.kind = kind;
+        }
+    }
+
+    // POSITION A FIXED-POINT TIME t OF THE WAY FROM a TO b, TO THE NEAREST
+    // PIXEL (halves round away from a)
+    static point lerp(point a, point b, int t) {
+        return point(a.x + scaleTime(b.x - a.x, t), a.y + scaleTime(b.y - a.y, t));
+    }
+    static int scaleTime(int delta, int t) {
+        int64_t scaled = static_cast<int64_t>(std::abs(delta)) * t + COLLISION_TIME_ONE / 2;
+        int step = static_cast<int>(scaled / COLLISION_TIME_ONE);
+        return delta < 0 ? -step : step;
+    }
+
+    // AABB TEST - same bounds as Obstacle::collidesWith
+    static int boxHit(int cx, int cy, int half, int x, int y, int size, Uint8 active) {
+        int h = size / 2;
+        return (active != 0) &
+               (cx + half > x - h) & (cx - half < x + h) &
+               (cy + half > y - h) & (cy - half < y + h);
+    }
+
+    static CollisionHits result(uint64_t mask, CollisionKind kind) {
+        CollisionHits hits = { mask, -1, NO_COLLISION, COLLISION_TIME_ONE };
+        if(mask != 0) {
+            hits.first = 0;
+            while(!((mask >> hits.first) & 1)) hits.first++;
+            hits.kind = kind;
+        }
+        return hits;
+    }
+
+    // MIDPOINT BETWEEN TWO CENTERS
+    static point midpoint(point a, point b) {
+        return point((a.x + b.x) / 2, (a.y + b.y) / 2);
     }
 };
 
@@ -40,12 +40,16 @@ const int ROAD_BOUNDARY_OFFSET = 10;
 const int COLLISION_COOLDOWN = 60;
 const int COLLISION_SPEED_PENALTY = 3;
 const int COLLISION_POINTS_PENALTY = 20;
+const int COLLISION_LANES = 16;            // Candidates tested per SIMD block
+const int COLLISION_BATCH = 64;            // Candidates per batched test (bits in a hit mask)
+const int COLLISION_TIME_ONE = 1 << 16;    // Fixed-point time of impact for a whole tick
 
-// POINTS SYSTEM
-const double SPEED_MULTIPLIER_BASE = 1.0;
-const double SPEED_MULTIPLIER_INCREMENT = 0.1;
+// POINTS SYSTEM (multipliers in fixed point, POINTS_FIXED_ONE = 1.0)
+const int POINTS_FIXED_ONE = 100;
+const int SPEED_MULTIPLIER_BASE = 100;        // 1.0
+const int SPEED_MULTIPLIER_INCREMENT = 10;    // 0.1 per speed step
 const int POINTS_PER_FRAME_BASE = 1;
-const double POINTS_PER_FRAME_MULTIPLIER = 0.05;
+const int POINTS_PER_FRAME_MULTIPLIER = 5;    // 0.05
 const int POINTS_CAR_PASS = 10;
 const int POINTS_OBSTACLE_AVOIDED = 5;
 
@@ -53,6 +57,18 @@ const int POINTS_OBSTACLE_AVOIDED = 5;
 const int AI_LANE_CHANGE_DELAY = 120;
 const int AI_LANE_CHANGE_THRESHOLD = 30;
 const int AI_SPAWN_Y_RANDOM_RANGE = 200;
+const int AI_LANE_LOOKAHEAD = 150;         // Pixels ahead an obstacle blocks a lane
+const int AI_DECISIONS_PER_TICK = 2;       // Lane decisions run per tick, however many cars are due
+const int AI_DECISION_WINDOW = 8;          // Due cars ranked per tick (at least the budget)
+const int AI_REPLAN_DELAY = 15;            // Ticks after a decision before a blocked car may decide again
+const int AI_DECISION_WAIT_WEIGHT = 4;     // Pixels of closeness one tick of waiting is worth
+
+// LANE OCCUPANCY (AI lane planning)
+const int OCCUPANCY_STEPS = 8;             // Future steps an AI plan looks through
+const int OCCUPANCY_STEP_TICKS = 8;        // Ticks per step (about a second in all)
+const int OCCUPANCY_BANDS = 64;            // Y bands, one bit each in a lane's row
+const int OCCUPANCY_BAND_HEIGHT = 16;      // Pixels per y band
+const int OCCUPANCY_TOP = COL + SIZE - OCCUPANCY_BANDS * OCCUPANCY_BAND_HEIGHT;   // Table ends where cars respawn
 
 // ROAD CONSTRAINTS
 const int ROAD_START = ROW / 4;
@@ -90,10 +106,95 @@ const int SCROLL_RESET_VALUE = 300;
 const int TEXT_Y_SPACING = 40;
 const int GAME_OVER_Y_SPACING = 35;
 
+// PARTICLES
+const int PARTICLE_CAPACITY = 32768;
+const int CRASH_EFFECT_FRAMES = 30;
+const int CRASH_SPARK_COUNT = 400;
+const int CRASH_DEBRIS_COUNT = 120;
+const int CRASH_SPARK_LIFE = 25;
+const int CRASH_DEBRIS_LIFE = 45;
+const int SKID_PARTICLES_PER_TIRE = 3;
+const int SKID_LIFE = 40;
+const int EXHAUST_LIFE = 12;
+const float CRASH_SPARK_SPEED = 6.0f;
+const float CRASH_DEBRIS_SPEED = 3.0f;
+const float EXHAUST_SPEED = 1.5f;
+const float PARTICLE_DRAG = 0.92f;
+
 // FONT SIZES
 const int FONT_LARGE_WIDTH = 30;
 const int FONT_SMALL_WIDTH = 15;
 
+// TEXT CACHE
+const size_t TEXT_CACHE_BYTES = 256 * 1024;
+const int TEXT_CACHE_SLOTS = 128;
+const int NUMBER_RUN_MAX_DIGITS = 11;
+
+// SCALED GLYPH CACHE
+const size_t GLYPH_CACHE_BYTES = 512 * 1024;
+const int GLYPH_CACHE_SLOTS = 512;
+const int GLYPH_SCALE_STEPS = 16;     // Scales are quantized to 1/16
+const float TITLE_SCALE = 1.5f;       // Screen titles, in large-font heights
+
+// NIGHT MODE
+const int NIGHT_AMBIENT = 45;          // Light level everywhere (0-255)
+const int HEADLIGHT_LENGTH = 150;      // Cone reach ahead of the bumper
+const float HEADLIGHT_SPREAD = 0.4f;   // Cone widening per pixel of reach
+const int HEADLIGHT_LEVEL = 230;
+const int CAR_GLOW_RADIUS = 20;
+const int CAR_GLOW_LEVEL = 110;
+
+// POST PROCESSING
+const double POST_FRAME_BUDGET_MS = 4.0;   // All passes together
+const int POST_OVER_BUDGET_FRAMES = 30;    // Frames over budget before a pass is dropped
+const int POST_UNDER_BUDGET_FRAMES = 120;  // Frames under half the budget before one comes back
+const int SCANLINE_LEVEL = 180;            // Odd-row brightness, out of 256
+const float VIGNETTE_STRENGTH = 0.45f;     // Edge darkening, 0 = none
+const int STREAK_MAX_WEIGHT = 150;         // History weight at MAX_SPEED, out of 256
+
+// ENTITY POOLS
+const int MAX_AI_CARS = 8;                 // AI car pool capacity, allocated at startup
+const int MAX_OBSTACLES = 8;               // Obstacle pool capacity, allocated at startup
+const int TRAFFIC_PER_LAP = 1;             // AI cars and obstacles added at each new lap
+
+// SPATIAL INDEX
+const int SPATIAL_BAND_WIDTH = 32;         // Obstacle column band width in pixels
+
+// JOB SYSTEM
+const int CACHE_LINE_BYTES = 64;           // Padding between per-worker state
+const int JOB_QUEUE_CAPACITY = 256;        // Jobs queued per worker before new ones run inline
+const int JOB_RANGES_PER_THREAD = 4;       // Parallel-for ranges per thread, for stealing to even out
+const int JOB_IDLE_SPINS = 256;            // Looks for work before an idle worker sleeps
+const int JOB_GRAPH_NODES = 16;            // Most jobs in one dependency graph
+const int JOB_GRAIN_ENTITIES = 256;        // Fewest entities in one parallel-for range (JobSystem::setTuning overrides)
+const int JOB_PARALLEL_ENTITIES = 2048;    // Entities in a store before its updates use the job system (same)
+
+// OFFLINE RENDERING
+const int KEYFRAME_INTERVAL = 300;         // Ticks between stored race states (also in session files)
+const int RENDER_CHUNK_FRAMES = 32;        // Frames rendered per parallel task
+const int EFFECT_WARMUP_TICKS = 64;        // Longer than any particle lives
+
+// SESSION RECORDING
+const int SESSION_FLUSH_MS = 250;                 // Longest queued input waits for the writer
+const int SESSION_RUN_SPLIT_TICKS = FPS_TARGET;   // Longest input run held back on the game thread
+const char* const SESSION_DEFAULT_PATH = "last_race.prs";   // Recording file without --record
+
+// SNAPSHOTS
+const char* const SNAPSHOT_CRASH_PATH = "crash_dump.prgs";  // Race state written on a fatal signal
+
+// TRAINING ENVIRONMENT
+const int ENV_MAX_TICKS = FPS_TARGET * 60 * 5;    // Ticks before an episode is cut off
+const int ENV_OBSERVED_CARS = 4;                  // Nearest AI cars in an entity observation
+const int ENV_OBSERVED_OBSTACLES = 4;             // Nearest obstacles in an entity observation
+const int ENV_PLAYER_FEATURES = 3;                // Player x, speed, lap
+const int ENV_ENTITY_FEATURES = 4;                // Present, dx, dy, speed or size
+const int ENV_OBSERVATION_SIZE = ENV_PLAYER_FEATURES +
+                                 (ENV_OBSERVED_CARS + ENV_OBSERVED_OBSTACLES) * ENV_ENTITY_FEATURES;
+const int ENV_FRAME_SCALE = 10;                   // Screen pixels per semantic frame cell
+const int ENV_FRAME_WIDTH = ROW / ENV_FRAME_SCALE;
+const int ENV_FRAME_HEIGHT = COL / ENV_FRAME_SCALE;
+const int ENV_TASKS_PER_THREAD = 4;               // Environment batches per pool thread per step
+
 // BASIC COLORS
 const color WHITE2(255, 255, 255);
 const color BLACK(0, 0, 0);
@@ -116,6 +217,11 @@ const color AI_BLUE(0, 100, 255);
 const color AI_GREEN(0, 255, 0);
 const color AI_YELLOW(255, 255, 0);
 
+// EFFECT COLORS
+const color SPARK(255, 200, 60);
+const color SKID_MARK(25, 25, 25);
+const color EXHAUST(70, 60, 50);
+
 // SCREEN BACKGROUND COLORS
 const color BG_START(20, 40, 80);
 const color BG_INSTRUCTIONS(30, 30, 50);
@@ -140,5 +246,27 @@ enum AILane {
     RIGHT_LANE = 2
 };
 
+// OBSERVATION MODE ENUM
+enum ObservationMode {
+    OBSERVE_ENTITIES,   // Player state plus nearest cars and obstacles, as floats
+    OBSERVE_FRAME       // Downsampled semantic frame, one class byte per cell
+};
+
+// SEMANTIC FRAME CELL ENUM
+enum FrameCell {
+    CELL_GRASS,
+    CELL_ROAD,
+    CELL_OBSTACLE,
+    CELL_AI_CAR,
+    CELL_PLAYER
+};
+
+// COLLISION KIND ENUM
+enum CollisionKind {
+    NO_COLLISION,
+    AI_COLLISION,
+    OBSTACLE_COLLISION
+};
+
 #endif /* Const_h */
 
@@ -0,0 +1,530 @@
+//================================================================
+// EntityStore.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Entity Store Implementation
+// Description: Field-by-field update loops, AI lane decisions, spawning,
+//              removal and respawn for AI cars and obstacles
+//================================================================
+
+#include "EntityStore.h"
+#include "StateStream.h"
+#include <algorithm>
+#include <cstdlib>
+
+// BUCKET EDGES - halfway between lanes, and every band across the road
+static std::vector<int> laneEdges() {
+    std::vector<int> edges;
+    for(int lane = LEFT_LANE; lane < RIGHT_LANE; lane++) {
+        edges.push_back((LANE_X[lane] + LANE_X[lane + 1]) / 2);
+    }
+    return edges;
+}
+
+static std::vector<int> bandEdges() {
+    std::vector<int> edges;
+    for(int x = ROAD_START + SPATIAL_BAND_WIDTH; x < ROAD_END; x += SPATIAL_BAND_WIDTH) {
+        edges.push_back(x);
+    }
+    return edges;
+}
+
+EntityStore::EntityStore(int maxAICars, int maxObstacles)
+    : aiPool(maxAICars),
+      obstaclePool(maxObstacles),
+      aiIndex(laneEdges()),
+      obstacleIndex(bandEdges()),
+      aiIndexed{false},
+      obstaclesIndexed{false},
+      maxObstacleSize{0},
+      maxAIStep{0},
+      maxObstacleStep{0},
+      jobs{nullptr},
+      aiDecisionCursor{0}
+{
+    aiX.reserve(maxAICars);      aiY.reserve(maxAICars);
+    aiPrvX.reserve(maxAICars);   aiPrvY.reserve(maxAICars);
+    aiSpeed.reserve(maxAICars);  aiLane.reserve(maxAICars);  aiTargetX.reserve(maxAICars);
+    aiTimer.reserve(maxAICars);  aiDelay.reserve(maxAICars);
+    aiChanging.reserve(maxAICars); aiColor.reserve(maxAICars);
+
+    obsX.reserve(maxObstacles);    obsY.reserve(maxObstacles);    obsPrvY.reserve(maxObstacles);
+    obsSize.reserve(maxObstacles); obsActive.reserve(maxObstacles);
+
+    aiIndex.reserve(maxAICars);
+    obstacleIndex.reserve(maxObstacles);
+    dueKeys.reserve(maxAICars);
+    seed(1);
+}
+
+void EntityStore::seed(uint64_t raceSeed) {
+    aiRandom.seed(raceSeed, RANDOM_STREAM_AI);
+    obstacleRandom.seed(raceSeed, RANDOM_STREAM_OBSTACLES);
+
+    // HANDLES - generations keyed by the race too, not by what the store held before
+    Random handles;
+    handles.seed(raceSeed, RANDOM_STREAM_HANDLES);
+    aiPool.setFreeGeneration(handles.next());
+    obstaclePool.setFreeGeneration(handles.next());
+}
+
+void EntityStore::setJobs(JobSystem* jobSystem) {
+    jobs = jobSystem;
+    workerOccupancy.resize(jobs ? jobs->getThreadCount() : 0);
+}
+
+void EntityStore::refreshIndex() const {
+    refreshAIIndex();
+    refreshObstacleIndex();
+}
+
+void EntityStore::refreshAIIndex() const {
+    if(!aiIndexed) {
+        aiIndex.build(aiX.data(), aiY.data(), getAICount(), jobsFor(getAICount()));
+        maxAIStep = 0;
+        for(int i = 0; i < getAICount(); i++) {
+            maxAIStep = std::max(maxAIStep, std::max(std::abs(aiX[i] - aiPrvX[i]), std::abs(aiY[i] - aiPrvY[i])));
+        }
+        aiIndexed = true;
+    }
+}
+
+void EntityStore::refreshObstacleIndex() const {
+    if(!obstaclesIndexed) {
+        obstacleIndex.build(obsX.data(), obsY.data(), getObstacleCount(), jobsFor(getObstacleCount()));
+        maxObstacleSize = 0;
+        maxObstacleStep = 0;
+        for(int i = 0; i < getObstacleCount(); i++) {
+            maxObstacleSize = std::max(maxObstacleSize, obsSize[i]);
+            maxObstacleStep = std::max(maxObstacleStep, std::abs(obsY[i] - obsPrvY[i]));
+        }
+        obstaclesIndexed = true;
+    }
+}
+
+void EntityStore::clear() {
+    aiX.clear();      aiY.clear();
+    aiPrvX.clear();   aiPrvY.clear();
+    aiSpeed.clear();  aiLane.clear();  aiTargetX.clear();
+    aiTimer.clear();  aiDelay.clear();
+    aiChanging.clear(); aiColor.clear();
+
+    obsX.clear();     obsY.clear();     obsPrvY.clear();
+    obsSize.clear();  obsActive.clear();
+    aiPool.clear();
+    obstaclePool.clear();
+    aiDecisionCursor = 0;
+    aiIndexed = obstaclesIndexed = false;
+}
+
+// SAVED STATE
+void EntityStore::saveState(StateWriter& out) const {
+    out.putArray(aiX);        out.putArray(aiY);
+    out.putArray(aiPrvX);     out.putArray(aiPrvY);
+    out.putArray(aiSpeed);    out.putArray(aiLane);     out.putArray(aiTargetX);
+    out.putArray(aiTimer);    out.putArray(aiDelay);
+    out.putArray(aiChanging); out.putArray(aiColor);
+
+    out.putArray(obsX);       out.putArray(obsY);       out.putArray(obsPrvY);
+    out.putArray(obsSize);    out.putArray(obsActive);
+
+    aiPool.saveState(out);
+    obstaclePool.saveState(out);
+
+    out.put(params);
+    out.put(aiDecisionCursor);
+    aiRandom.saveState(out);
+    obstacleRandom.saveState(out);
+}
+
+void EntityStore::loadState(StateReader& in) {
+    in.getArray(aiX);         in.getArray(aiY);
+    in.getArray(aiPrvX);      in.getArray(aiPrvY);
+    in.getArray(aiSpeed);     in.getArray(aiLane);      in.getArray(aiTargetX);
+    in.getArray(aiTimer);     in.getArray(aiDelay);
+    in.getArray(aiChanging);  in.getArray(aiColor);
+
+    in.getArray(obsX);        in.getArray(obsY);        in.getArray(obsPrvY);
+    in.getArray(obsSize);     in.getArray(obsActive);
+
+    aiPool.loadState(in);
+    obstaclePool.loadState(in);
+
+    in.get(params);
+    in.get(aiDecisionCursor);
+    aiRandom.loadState(in);
+    obstacleRandom.loadState(in);
+    aiIndexed = obstaclesIndexed = false;
+
+    // EVERY FIELD ARRAY THE POOL'S LENGTH, LANES INDEX LANE_X, CURSOR NOT
+    // NEGATIVE, TUNING AS setParams WOULD LEAVE IT
+    size_t cars = aiX.size(), obstacles = obsX.size();
+    bool sized = cars == static_cast<size_t>(aiPool.getCount()) &&
+                 obstacles == static_cast<size_t>(obstaclePool.getCount()) &&
+                 aiY.size() == cars && aiPrvX.size() == cars && aiPrvY.size() == cars &&
+                 aiSpeed.size() == cars && aiLane.size() == cars && aiTargetX.size() == cars &&
+                 aiTimer.size() == cars && aiDelay.size() == cars && aiChanging.size() == cars &&
+                 aiColor.size() == cars && obsY.size() == obstacles && obsPrvY.size() == obstacles &&
+                 obsSize.size() == obstacles && obsActive.size() == obstacles;
+    sized = sized && aiDecisionCursor >= 0 && params.inRange();
+    for(size_t i = 0; sized && i < cars; i++) sized = aiLane[i] >= 0 && aiLane[i] < 3;
+    if(!sized) in.fail();
+}
+
+// ONE ENTRY OF EVERY FIELD ARRAY (keep in step with saveState)
+static const size_t AI_CAR_STATE_BYTES = 9 * sizeof(int) + sizeof(Uint8) + sizeof(color);
+static const size_t OBSTACLE_STATE_BYTES = 4 * sizeof(int) + sizeof(Uint8);
+
+size_t EntityStore::getStateGrowth() const {
+    return (getAICapacity() - getAICount()) * AI_CAR_STATE_BYTES +
+           (getObstacleCapacity() - getObstacleCount()) * OBSTACLE_STATE_BYTES;
+}
+
+// SPAWN AND REMOVE
+EntityHandle EntityStore::addAICar(int y, color carColor, int speed) {
+    EntityHandle handle = aiPool.acquire();
+    if(handle.isNone()) return handle;
+
+    int lane = aiRandom.nextInt(3);
+    aiX.push_back(LANE_X[lane]);
+    aiY.push_back(y);
+    aiPrvX.push_back(LANE_X[lane]);
+    aiPrvY.push_back(y);
+    aiSpeed.push_back(speed);
+    aiLane.push_back(lane);
+    aiTargetX.push_back(LANE_X[lane]);
+    aiTimer.push_back(0);
+    aiDelay.push_back(params.laneChangeDelay);
+    aiChanging.push_back(0);
+    aiColor.push_back(carColor);
+    aiIndexed = false;
+    return handle;
+}
+
+EntityHandle EntityStore::addObstacle(int x, int y, int size) {
+    EntityHandle handle = obstaclePool.acquire();
+    if(handle.isNone()) return handle;
+
+    obsX.push_back(x);
+    obsY.push_back(y);
+    obsPrvY.push_back(y);
+    obsSize.push_back(size);
+    obsActive.push_back(1);
+    obstaclesIndexed = false;
+    return handle;
+}
+
+// REMOVE - the pool moves the last entity into the hole; its fields follow
+bool EntityStore::removeAICar(EntityHandle handle) {
+    int i = aiPool.find(handle);
+    if(i < 0) return false;
+    int last = aiPool.release(i);
+    aiX[i] = aiX[last];             aiY[i] = aiY[last];
+    aiPrvX[i] = aiPrvX[last];       aiPrvY[i] = aiPrvY[last];
+    aiSpeed[i] = aiSpeed[last];     aiLane[i] = aiLane[last];   aiTargetX[i] = aiTargetX[last];
+    aiTimer[i] = aiTimer[last];     aiDelay[i] = aiDelay[last];
+    aiChanging[i] = aiChanging[last]; aiColor[i] = aiColor[last];
+
+    aiX.pop_back();       aiY.pop_back();
+    aiPrvX.pop_back();    aiPrvY.pop_back();
+    aiSpeed.pop_back();   aiLane.pop_back();  aiTargetX.pop_back();
+    aiTimer.pop_back();   aiDelay.pop_back();
+    aiChanging.pop_back(); aiColor.pop_back();
+    aiIndexed = false;
+    return true;
+}
+
+bool EntityStore::removeObstacle(EntityHandle handle) {
+    int i = obstaclePool.find(handle);
+    if(i < 0) return false;
+    int last = obstaclePool.release(i);
+    obsX[i] = obsX[last];         obsY[i] = obsY[last];       obsPrvY[i] = obsPrvY[last];
+    obsSize[i] = obsSize[last];   obsActive[i] = obsActive[last];
+
+    obsX.pop_back();      obsY.pop_back();      obsPrvY.pop_back();
+    obsSize.pop_back();   obsActive.pop_back();
+    obstaclesIndexed = false;
+    return true;
+}
+
+// TRAFFIC RAMP - new cars take the next color and speed in the starting
+// pattern; both kinds are placed above the screen like a respawn
+void EntityStore::addTraffic(int count) {
+    static const color COLORS[3] = { AI_BLUE, AI_GREEN, AI_YELLOW };
+    for(int n = 0; n < count; n++) {
+        int cars = getAICount();
+        EntityHandle car = addAICar(0, COLORS[cars % 3], 3 + cars % 3 + params.aiSpeedBonus);
+        if(!car.isNone()) respawnAICar(aiPool.find(car));
+
+        EntityHandle obstacle = addObstacle(0, 0);
+        if(!obstacle.isNone()) respawnObstacle(obstaclePool.find(obstacle));
+    }
+}
+
+// AI CARS
+
+bool EntityStore::isLaneBlocked(int lane, int y) const {
+    const int laneX = LANE_X[lane];
+    bool blocked = false;
+
+    // Same lane horizontally, ahead within danger distance
+    const int lookahead = params.laneLookahead;
+    queryObstacles(laneX, laneX, y + 1, y + lookahead - 1, [&](int i) {
+        blocked = std::abs(obsX[i] - laneX) <= obsSize[i] / 2 &&
+                  obsY[i] > y && obsY[i] - y < lookahead;
+        return blocked;
+    });
+    return blocked;
+}
+
+// OCCUPANCY - one pass over every entity serves every decision this
+// tick. The player holds its place on screen, obstacles are expected to
+// keep scrolling as they did last tick, and both block each lane a car
+// body would touch them in; cars hold the cells of their target lane,
+// and of the lane they are leaving
+void EntityStore::buildOccupancy(point player) {
+    occupancy.clear();
+    for(int lane = LEFT_LANE; lane <= RIGHT_LANE; lane++) {
+        if(std::abs(player.x - LANE_X[lane]) <= SIZE) occupancy.addObstacle(lane, player.y, 0, SIZE / 2);
+    }
+
+    JobSystem* parallel = jobsFor(getAICount() + getObstacleCount());
+    if(!parallel) {
+        for(int i = 0; i < getObstacleCount(); i++) markObstacle(occupancy, i);
+        for(int i = 0; i < getAICount(); i++) planCar(occupancy, i);
+        return;
+    }
+
+    // PER-WORKER TABLES - a table only records which bands are held once
+    // and which more than once, so merging them gives the serial table
+    // whichever worker took which range
+    for(WorkerSlot<LaneOccupancy>& slot : workerOccupancy) slot.value.clear();
+    parallelFor(parallel, getObstacleCount(), [&](int begin, int end, int worker) {
+        for(int i = begin; i < end; i++) markObstacle(workerOccupancy[worker].value, i);
+    });
+    parallelFor(parallel, getAICount(), [&](int begin, int end, int worker) {
+        for(int i = begin; i < end; i++) planCar(workerOccupancy[worker].value, i);
+    });
+    for(const WorkerSlot<LaneOccupancy>& slot : workerOccupancy) occupancy.merge(slot.value);
+}
+
+void EntityStore::markObstacle(LaneOccupancy& table, int i) const {
+    if(!obsActive[i]) return;
+    for(int lane = LEFT_LANE; lane <= RIGHT_LANE; lane++) {
+        if(std::abs(obsX[i] - LANE_X[lane]) <= (SIZE + obsSize[i]) / 2) {
+            table.addObstacle(lane, obsY[i], obsY[i] - obsPrvY[i], obsSize[i] / 2);
+        }
+    }
+}
+
+void EntityStore::planCar(LaneOccupancy& table, int i) const {
+    int lane = aiLane[i];
+    int leaving = aiIndex.bucketOf(aiX[i]);   // AI buckets are the nearest lane
+    table.reserve(lane, aiY[i], aiSpeed[i], SIZE / 2);
+    if(leaving != lane) table.reserve(leaving, aiY[i], aiSpeed[i], SIZE / 2);
+}
+
+bool EntityStore::laneClear(int i) const {
+    return occupancy.isClear(aiLane[i], aiY[i], aiSpeed[i], SIZE / 2, params.laneLookahead, true);
+}
+
+// LANE CHOICE - a lane is open if the car could drive down it for the
+// whole plan without meeting an obstacle or another car's cells. A
+// deciding car sits on its lane, so it holds just that one; moving
+// keeps it (the car is still there) and reserves the new lane too
+void EntityStore::chooseLane(int i) {
+    int candidates[3];
+    int count = 0;
+    const int own = aiLane[i];
+    const int y = aiY[i];
+    const int speed = aiSpeed[i];
+    const int lookahead = params.laneLookahead;
+
+    if(!laneClear(i)) {
+        for(int lane = LEFT_LANE; lane <= RIGHT_LANE; lane++) {
+            if(lane != own && occupancy.isClear(lane, y, speed, SIZE / 2, lookahead, false)) candidates[count++] = lane;
+        }
+    } else if(aiRandom.nextInt(100) < params.laneChangeThreshold) {
+        for(int lane = LEFT_LANE; lane <= RIGHT_LANE; lane++) {
+            if(lane != own && occupancy.isClear(lane, y, speed, SIZE / 2, lookahead, false)) candidates[count++] = lane;
+        }
+    }
+
+    if(count > 0) {
+        aiLane[i] = candidates[aiRandom.nextInt(count)];
+        aiTargetX[i] = LANE_X[aiLane[i]];
+        occupancy.reserve(aiLane[i], y, speed, SIZE / 2);
+    }
+}
+
+// DECISION SCHEDULER - up to a window of due cars, taken in turn from
+// the cursor, are ranked by how close they are to the player or to an
+// obstacle ahead in their lane, less a bonus for every tick they have
+// waited; only the budget's worth decide, and the window starts at the
+// first car passed over next tick, so no car waits for ever. A car whose
+// own lane stops being clear is due early, ahead of the rest
+void EntityStore::scheduleDecisions(point player) {
+    const int n = getAICount();
+    if(n == 0) return;
+    const int budget = std::max(0, params.aiDecisionBudget);
+    const int window = std::max(budget, AI_DECISION_WINDOW);
+    const int start = aiDecisionCursor % n;
+    int scanned = 0;
+    dueKeys.clear();
+    buildOccupancy(player);
+    for(; scanned < n && static_cast<int>(dueKeys.size()) < window; scanned++) {
+        int i = (start + scanned) % n;
+        // Cars leaving the screen respawn with a fresh timer instead
+        if(aiChanging[i] || aiY[i] > COL + SIZE) continue;
+        if(aiTimer[i] >= aiDelay[i] || (aiTimer[i] >= AI_REPLAN_DELAY && !laneClear(i))) dueKeys.push_back(i);
+    }
+    aiDecisionCursor = (start + scanned) % n;
+
+    if(static_cast<int>(dueKeys.size()) > budget) {
+        const int maxBonus = COL * AI_DECISION_WAIT_WEIGHT;
+        for(uint64_t& key : dueKeys) {
+            int i = static_cast<int>(key);
+            // Cars due early have a blocked plan, the most urgent of all
+            int closeness = aiTimer[i] < aiDelay[i] ? 0 :
+                            std::min(std::min(std::abs(aiY[i] - player.y), occupancy.obstacleGap(aiLane[i], aiY[i])), COL);
+            int bonus = std::min(std::max(aiTimer[i] - aiDelay[i], 0), COL) * AI_DECISION_WAIT_WEIGHT;
+            key = static_cast<uint64_t>(closeness - bonus + maxBonus) << 32 | static_cast<uint32_t>(i);
+        }
+        std::nth_element(dueKeys.begin(), dueKeys.begin() + budget, dueKeys.end());
+
+        // Next window starts at the earliest car (in scan order) left waiting
+        int firstLeft = n;
+        for(size_t k = budget; k < dueKeys.size(); k++) {
+            firstLeft = std::min(firstLeft, (static_cast<int>(dueKeys[k] & 0xFFFFFFFFu) - start + n) % n);
+        }
+        aiDecisionCursor = (start + firstLeft) % n;
+
+        dueKeys.resize(budget);
+        for(uint64_t& key : dueKeys) key &= 0xFFFFFFFFu;
+        std::sort(dueKeys.begin(), dueKeys.end());   // Chosen cars draw random numbers in index order
+    }
+
+    for(uint64_t key : dueKeys) {
+        int i = static_cast<int>(key);
+        aiTimer[i] = 0;
+        chooseLane(i);
+    }
+}
+
+void EntityStore::respawnAICar(int i) {
+    aiLane[i] = aiRandom.nextInt(3);
+    aiTargetX[i] = LANE_X[aiLane[i]];
+    aiX[i] = aiTargetX[i];
+    aiY[i] = -SIZE - aiRandom.nextInt(params.aiSpawnRange);
+    aiPrvX[i] = aiX[i];
+    aiPrvY[i] = aiY[i];
+    aiTimer[i] = 0;
+    aiIndexed = false;
+}
+
+int EntityStore::updateAICars(point player) {
+    planAICars(player);
+    return finishAICars();
+}
+
+// Loops over fields run in ranges on the job system when there is one;
+// each entity's fields are written by its own range only
+void EntityStore::planAICars(point player) {
+    const int n = getAICount();
+    int* x = aiX.data();
+    int* y = aiY.data();
+    int* px = aiPrvX.data();
+    int* py = aiPrvY.data();
+    const int* speed = aiSpeed.data();
+    int* timer = aiTimer.data();
+
+    // MOVE - one loop per field so each vectorizes
+    parallelFor(jobsFor(n), n, [&](int begin, int end, int) {
+        for(int i = begin; i < end; i++) px[i] = x[i];
+        for(int i = begin; i < end; i++) py[i] = y[i];
+        for(int i = begin; i < end; i++) y[i] += speed[i];
+        for(int i = begin; i < end; i++) timer[i]++;
+    });
+
+    // DECIDE - draws random numbers, so in car order on this thread
+    scheduleDecisions(player);
+}
+
+int EntityStore::finishAICars() {
+    const int n = getAICount();
+    int* x = aiX.data();
+    const int* y = aiY.data();
+
+    // RESPAWN - draws random numbers too, so in car order on this thread
+    int respawned = 0;
+    for(int i = 0; i < n; i++) {
+        if(y[i] > COL + SIZE) {
+            respawnAICar(i);
+            respawned++;
+        }
+    }
+
+    // STEER TOWARD TARGET LANE (respawned cars already sit on it)
+    const int* target = aiTargetX.data();
+    Uint8* changing = aiChanging.data();
+    parallelFor(jobsFor(n), n, [&](int begin, int end, int) {
+        for(int i = begin; i < end; i++) {
+            int step = x[i] < target[i] - LANE_CHANGE_THRESHOLD ? LANE_CHANGE_STEP :
+                       (x[i] > target[i] + LANE_CHANGE_THRESHOLD ? -LANE_CHANGE_STEP : 0);
+            x[i] = step != 0 ? x[i] + step : target[i];
+        }
+        for(int i = begin; i < end; i++) changing[i] = x[i] != target[i];
+    });
+
+    aiIndexed = false;
+    refreshAIIndex();
+    return respawned;
+}
+
+// OBSTACLES
+
+void EntityStore::respawnObstacle(int i) {
+    obsX[i] = ROAD_START + OBSTACLE_SPAWN_MIN_X_OFFSET +
+              obstacleRandom.nextInt(ROAD_WIDTH - OBSTACLE_SPAWN_MAX_X_OFFSET);
+    obsY[i] = -obsSize[i] - obstacleRandom.nextInt(params.obstacleSpawnRange);
+    obsPrvY[i] = obsY[i];
+    obsActive[i] = 1;
+    obstaclesIndexed = false;
+}
+
+int EntityStore::updateObstacles(int playerSpeed) {
+    const int n = getObstacleCount();
+    int* y = obsY.data();
+    int* py = obsPrvY.data();
+    const int* size = obsSize.data();
+    const Uint8* active = obsActive.data();
+
+    // SCROLL (branch-free so the loops vectorize)
+    parallelFor(jobsFor(n), n, [&](int begin, int end, int) {
+        for(int i = begin; i < end; i++) py[i] = y[i];
+        for(int i = begin; i < end; i++) {
+            y[i] += active[i] ? playerSpeed : 0;
+        }
+    });
+
+    int respawned = 0;
+    for(int i = 0; i < n; i++) {
+        if(y[i] > COL + size[i]) {
+            respawnObstacle(i);
+            respawned++;
+        }
+    }
+
+    obstaclesIndexed = false;
+    refreshObstacleIndex();
+    return respawned;
+}
+
+// VIEWS
+
+AICar EntityStore::getAICar(int i) const {
+    return AICar(const_cast<EntityStore&>(*this), i);
+}
+
+Obstacle EntityStore::getObstacle(int i) const {
+    return Obstacle(const_cast<EntityStore&>(*this), i);
+}
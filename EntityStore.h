@@ -0,0 +1,391 @@
+//================================================================
+// EntityStore.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Entity Store
+// Description: Structure-of-arrays storage for AI cars and obstacles,
+//              updated by tight non-virtual loops over each field, in
+//              fixed-capacity pools addressed by generational handles
+//================================================================
+
+#ifndef EntityStore_h
+#define EntityStore_h
+
+#include "Const.h"
+#include "Car.h"
+#include "Obstacle.h"
+#include "SpatialIndex.h"
+#include "HandlePool.h"
+#include "LaneOccupancy.h"
+#include "JobSystem.h"
+#include "Random.h"
+#include "RaceParams.h"
+#include <vector>
+
+// LANE X-POSITIONS BY AILane
+const int LANE_X[3] = { LEFT_LANE_X, CENTER_LANE_X, RIGHT_LANE_X };
+
+class EntityStore {
+private:
+    // AI CARS (one entry per car)
+    std::vector<int>    aiX, aiY;            // Current position
+    std::vector<int>    aiPrvX, aiPrvY;      // Position before this tick
+    std::vector<int>    aiSpeed;             // Pixels moved down per tick
+    std::vector<int>    aiLane;              // Target lane (AILane)
+    std::vector<int>    aiTargetX;           // X-position of the target lane
+    std::vector<int>    aiTimer;             // Ticks since last lane decision
+    std::vector<int>    aiDelay;             // Ticks between lane decisions
+    std::vector<Uint8>  aiChanging;          // 1 while steering toward aiLane
+    std::vector<color>  aiColor;             // Body color
+
+    // OBSTACLES (one entry per obstacle)
+    std::vector<int>    obsX, obsY;          // Current position
+    std::vector<int>    obsPrvY;             // Y before this tick (x only changes on respawn)
+    std::vector<int>    obsSize;             // Cone size in pixels
+    std::vector<Uint8>  obsActive;           // 1 if drawn and collidable
+
+    // POOLS - the field arrays above stay packed (entry i is dense index i),
+    // reserved to capacity so spawning never allocates
+    HandlePool           aiPool;             // AI car slots and handles
+    HandlePool           obstaclePool;       // Obstacle slots and handles
+
+    RaceParams           params;             // AI and spawn tuning
+
+    // RANDOM STREAMS - one per system, keyed by the race seed
+    Random               aiRandom;           // Lane choices and AI respawns
+    Random               obstacleRandom;     // Obstacle respawns
+
+    // SPATIAL INDEX - rebuilt once per update, or on the next query after
+    // a single entity changes
+    mutable SpatialIndex aiIndex;            // AI cars by nearest lane
+    mutable SpatialIndex obstacleIndex;      // Obstacles by column band
+    mutable bool         aiIndexed;          // aiIndex matches the arrays
+    mutable bool         obstaclesIndexed;   // obstacleIndex matches the arrays
+    mutable int          maxObstacleSize;    // Largest obstacle when indexed
+    mutable int          maxAIStep;          // Farthest any AI car moved on an axis this tick
+    mutable int          maxObstacleStep;    // Farthest any obstacle moved this tick
+
+    /*
+     * Description: Rebuild whichever index is out of date, or one of them
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Both indexes (or the one named) match the arrays;
+     *                 the AI and obstacle halves touch no shared state, so
+     *                 they can run on different threads
+     */
+    void refreshIndex() const;
+    void refreshAIIndex() const;
+    void refreshObstacleIndex() const;
+
+    // JOB SYSTEM - not saved; per-worker scratch sized to its threads
+    JobSystem*                            jobs;              // Null to update on the calling thread
+    std::vector<WorkerSlot<LaneOccupancy>> workerOccupancy;  // Partial tables, merged in worker order
+
+    /*
+     * Description: Job system for a loop over count entities
+     * Return: JobSystem* - jobs, or null below its parallel threshold
+     *         (handing out a few dozen entities costs more than it saves)
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    JobSystem* jobsFor(int count) const {
+        return jobs && count >= jobs->getParallelEntities() ? jobs : nullptr;
+    }
+
+    // DECISION SCHEDULER - the cursor is saved, the rest is per-tick scratch
+    int                   aiDecisionCursor;  // Car the next tick's scan for due decisions starts at
+    std::vector<uint64_t> dueKeys;           // (urgency, index) of each car in the tick's window
+    LaneOccupancy         occupancy;         // Predicted lane use, rebuilt every tick
+
+    /*
+     * Description: Fill the occupancy table from the player, every active
+     *              obstacle's last step, and every car's speed and lanes
+     * Return: void
+     * Pre-condition: Cars have moved this tick
+     * Post-condition: Each car holds a reservation; O(entities), no
+     *                 allocation; with a job system, ranges of entities fill
+     *                 per-worker tables that merge to the same table
+     */
+    void buildOccupancy(point player);
+
+    /*
+     * Description: Block the lanes one obstacle touches, or reserve the
+     *              cells one AI car will drive through: its target lane,
+     *              and the lane it is leaving if changing
+     * Return: void
+     * Pre-condition: 0 <= i < count
+     * Post-condition: table updated
+     */
+    void markObstacle(LaneOccupancy& table, int i) const;
+    void planCar(LaneOccupancy& table, int i) const;
+
+    /*
+     * Description: Check an AI car can keep its target lane for the plan
+     * Return: bool - true if nothing else needs its cells
+     * Pre-condition: 0 <= i < getAICount(), car sits on its lane,
+     *                occupancy built
+     * Post-condition: No state change; O(1)
+     */
+    bool laneClear(int i) const;
+
+    /*
+     * Description: Pick a new target lane for one AI car
+     * Return: void
+     * Pre-condition: 0 <= i < getAICount(), car has moved this tick,
+     *                occupancy built
+     * Post-condition: aiLane[i] may change, reserving the new lane too;
+     *                 consumes the AI stream
+     */
+    void chooseLane(int i);
+
+    /*
+     * Description: Run the lane decisions of the cars most in need of one
+     * Return: void
+     * Pre-condition: Cars have moved this tick
+     * Post-condition: Occupancy rebuilt; at most params.aiDecisionBudget
+     *                 cars decided, in index order, out of a window of
+     *                 AI_DECISION_WINDOW due cars (on schedule, or early
+     *                 with a blocked lane); cars left waiting keep
+     *                 counting up, gain priority each tick they wait,
+     *                 and start the next tick's window
+     */
+    void scheduleDecisions(point player);
+
+public:
+    /*
+     * Description: Create an empty store and allocate both pools
+     * Return: None (constructor)
+     * Pre-condition: maxAICars >= 0, maxObstacles >= 0
+     * Post-condition: No entities; every array and index reserved for the
+     *                 capacities; AI cars bucketed by lane, obstacles by
+     *                 SPATIAL_BAND_WIDTH column bands
+     */
+    EntityStore(int maxAICars = MAX_AI_CARS, int maxObstacles = MAX_OBSTACLES);
+
+    /*
+     * Description: Remove every AI car and obstacle
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Both counts are 0, capacity kept; every handle stale
+     */
+    void clear();
+
+    /*
+     * Description: Restart the AI and obstacle random streams for a race
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Streams keyed by raceSeed and RANDOM_STREAM_AI /
+     *                 RANDOM_STREAM_OBSTACLES; free slots' handle
+     *                 generations keyed by raceSeed, so after clear() a
+     *                 race's handles depend only on its seed
+     */
+    void seed(uint64_t raceSeed);
+
+    /*
+     * Description: Set the AI and spawn tuning
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: raceParams.clamped() used by cars and respawns from
+     *                 now on; cars already added keep their lane decision
+     *                 delay
+     */
+    void setParams(const RaceParams& raceParams) { params = raceParams.clamped(); }
+    const RaceParams& getParams() const { return params; }
+
+    /*
+     * Description: Run the entity loops of each update on a job system
+     * Return: void
+     * Pre-condition: jobSystem outlives the store, or is null
+     * Post-condition: Stores of the system's parallel threshold or more
+     *                 entities split their loops into ranges across its threads;
+     *                 random draws stay in entity order on the calling
+     *                 thread, so every result matches a null jobSystem
+     */
+    void setJobs(JobSystem* jobSystem);
+
+    /*
+     * Description: Save or restore every car and obstacle field, both
+     *              pools, the tuning, and both random streams
+     * Return: void
+     * Pre-condition: in holds what saveState wrote for a store of the same
+     *                capacities
+     * Post-condition: Arrays reuse their capacity; indexes rebuilt on the
+     *                 next query; in fails on mismatched array lengths or
+     *                 pools, an out-of-range lane, or tuning out of range
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
+
+    /*
+     * Description: Room a saved state needs for traffic still to come
+     * Return: size_t - bytes saveState would add with both pools full
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    size_t getStateGrowth() const;
+
+    /*
+     * Description: Add an AI car in a random lane
+     * Return: EntityHandle - the new car, none if the pool is full
+     * Pre-condition: speed >= 0
+     * Post-condition: Car appended at (lane x, y) as index getAICount() - 1;
+     *                 consumes the AI stream; no allocation
+     */
+    EntityHandle addAICar(int y, color carColor, int speed = CAR_START_SPEED);
+
+    /*
+     * Description: Add an active obstacle
+     * Return: EntityHandle - the new obstacle, none if the pool is full
+     * Pre-condition: size > 0
+     * Post-condition: Obstacle appended at (x, y) as index
+     *                 getObstacleCount() - 1; no allocation
+     */
+    EntityHandle addObstacle(int x, int y, int size = OBSTACLE_SIZE);
+
+    /*
+     * Description: Remove one entity in O(1)
+     * Return: bool - false if the handle is none or stale
+     * Pre-condition: None
+     * Post-condition: The last entity moves into the removed one's index
+     *                 (so later updates visit it there); handle stale
+     */
+    bool removeAICar(EntityHandle handle);
+    bool removeObstacle(EntityHandle handle);
+
+    /*
+     * Description: Add count more AI cars and obstacles above the screen,
+     *              as far as the pools allow
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: New entities placed like respawns; consumes the AI
+     *                 and obstacle streams; no allocation
+     */
+    void addTraffic(int count);
+
+    /*
+     * Description: Advance every AI car one tick: move, decide lanes, respawn, steer
+     * Return: int - number of cars that left the screen and respawned
+     * Pre-condition: Obstacles are in their positions for this tick;
+     *                player is the player's position (cars plan around
+     *                it, and those near it decide first)
+     * Post-condition: Lane decisions limited to params.aiDecisionBudget,
+     *                 so the cost of a tick does not grow with cars due
+     */
+    int updateAICars(point player = point(PLAYER_START_X, PLAYER_START_Y));
+
+    /*
+     * Description: The two halves of updateAICars: move and decide lanes,
+     *              then respawn and steer
+     * Return: void; int - number of cars that respawned
+     * Pre-condition: As updateAICars; finishAICars after planAICars
+     * Post-condition: Both together do what updateAICars does; once
+     *                 cars have decided, finishAICars and updateObstacles
+     *                 touch no shared state and may run at the same time
+     */
+    void planAICars(point player);
+    int finishAICars();
+
+    /*
+     * Description: Scroll every obstacle with the road and respawn those off screen
+     * Return: int - number of obstacles that respawned
+     * Pre-condition: playerSpeed is valid
+     * Post-condition: Active obstacles moved down playerSpeed pixels
+     */
+    int updateObstacles(int playerSpeed);
+
+    /*
+     * Description: Check if an obstacle sits in a lane just ahead of y
+     * Return: bool - true if blocked
+     * Pre-condition: lane is a valid AILane
+     * Post-condition: No state change; O(log n + k) in nearby obstacles
+     */
+    bool isLaneBlocked(int lane, int y) const;
+
+    /*
+     * Description: Visit entities whose body may overlap a box now or at
+     *              any point of their motion during the last tick
+     * Return: void
+     * Pre-condition: x0 <= x1, y0 <= y1; visit(int index) returns true to stop
+     * Post-condition: Every entity overlapping the box is visited (plus some
+     *                 near misses, so callers apply the exact test)
+     */
+    template <typename Visit>
+    void queryAICars(int x0, int x1, int y0, int y1, Visit visit) const {
+        refreshIndex();
+        int reach = SIZE / 2 + maxAIStep;
+        aiIndex.query(x0 - reach, x1 + reach, y0 - reach, y1 + reach, visit);
+    }
+    template <typename Visit>
+    void queryObstacles(int x0, int x1, int y0, int y1, Visit visit) const {
+        refreshIndex();
+        int reach = maxObstacleSize / 2 + maxObstacleStep;
+        obstacleIndex.query(x0 - reach, x1 + reach, y0 - reach, y1 + reach, visit);
+    }
+
+    /*
+     * Description: Move one entity back to the top of the road
+     * Return: void
+     * Pre-condition: i is a valid index
+     * Post-condition: Entity repositioned; consumes the AI or obstacle stream
+     */
+    void respawnAICar(int i);
+    void respawnObstacle(int i);
+
+    /*
+     * Description: Change one obstacle's position or active flag
+     * Return: void
+     * Pre-condition: i is a valid index
+     * Post-condition: Field updated
+     */
+    void moveObstacle(int i, int dy) { obsPrvY[i] = obsY[i]; obsY[i] += dy; obstaclesIndexed = false; }
+    void setObstacleActive(int i, bool active) { obsActive[i] = active; }
+
+    /*
+     * Description: Get Car/Obstacle views of one entry
+     * Return: View holding a copy of the entry; write-through calls
+     *         (respawn, update, deactivate) go back to the store
+     * Pre-condition: i is a valid index, store outlives the view, and no
+     *                entity is removed while it is used (keep a handle
+     *                across ticks instead)
+     * Post-condition: No state change
+     */
+    AICar getAICar(int i) const;
+    Obstacle getObstacle(int i) const;
+
+    /*
+     * Description: Resolve a handle, or get the handle of an index
+     * Return: int - current index, -1 if the entity is gone;
+     *         EntityHandle - handle of the entity at index i
+     * Pre-condition: 0 <= i < count for the handle getters
+     * Post-condition: No state change
+     */
+    int findAICar(EntityHandle handle) const { return aiPool.find(handle); }
+    int findObstacle(EntityHandle handle) const { return obstaclePool.find(handle); }
+    EntityHandle getAIHandle(int i) const { return aiPool.handleAt(i); }
+    EntityHandle getObstacleHandle(int i) const { return obstaclePool.handleAt(i); }
+
+    /*
+     * Description: Entity counts and read-only field arrays
+     * Return: Requested value or array of getAICount()/getObstacleCount() entries
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getAICount() const { return static_cast<int>(aiX.size()); }
+    int getObstacleCount() const { return static_cast<int>(obsX.size()); }
+    int getAICapacity() const { return aiPool.getCapacity(); }
+    int getObstacleCapacity() const { return obstaclePool.getCapacity(); }
+    const int* getAIX() const { return aiX.data(); }
+    const int* getAIY() const { return aiY.data(); }
+    const int* getAIPrvX() const { return aiPrvX.data(); }
+    const int* getAIPrvY() const { return aiPrvY.data(); }
+    const int* getAISpeed() const { return aiSpeed.data(); }
+    const int* getAILane() const { return aiLane.data(); }
+    const int* getAITimer() const { return aiTimer.data(); }
+    color getAIColor(int i) const { return aiColor[i]; }
+    const int* getObstacleX() const { return obsX.data(); }
+    const int* getObstacleY() const { return obsY.data(); }
+    const int* getObstaclePrvY() const { return obsPrvY.data(); }
+    const int* getObstacleSize() const { return obsSize.data(); }
+    const Uint8* getObstacleActive() const { return obsActive.data(); }
+};
+
+#endif /* EntityStore_h */
@@ -5,585 +5,249 @@
 //==================================================
 
 #include "Font.h"
+#include "FontGlyphs.h"
+#include "Const.h"
+#include "TextCache.h"
 #include <cctype>
 
+// FONT METRICS
+struct FontFace {
+    const GlyphBitmap* atlas;  // Glyph bitmaps, indexed by glyphIndex()
+    int rows;                  // Cell height in pixels
+    int advance;               // Pen advance per glyph
+    int spaceAdvance;          // Extra pen advance for a space
+    int flashPeriod;           // Frames per on/off flash cycle
+};
+
+static const FontFace LARGE_FACE = { LARGE_ATLAS, LARGE_GLYPH_ROWS, FONT_LARGE_WIDTH, FONT_LARGE_WIDTH / 8, 20 };
+static const FontFace SMALL_FACE = { SMALL_ATLAS, SMALL_GLYPH_ROWS, FONT_SMALL_WIDTH, FONT_SMALL_WIDTH / 2, 30 };
+
+static const FontFace& faceFor(FontSize font) {
+    return font == FONT_LARGE ? LARGE_FACE : SMALL_FACE;
+}
+
+// MAP CHARACTER TO ATLAS INDEX
+static int glyphIndex(char ch) {
+    if(ch >= 'A' && ch <= 'Z') return ch - 'A';
+    if(ch >= '0' && ch <= '9') return GLYPH_DIGIT_0 + (ch - '0');
+    switch(ch) {
+        case ':': return GLYPH_COLON;
+        case '.': return GLYPH_PERIOD;
+        case '!': return GLYPH_BANG;
+        case '/': return GLYPH_SLASH;
+        case '=': return GLYPH_EQUALS;
+        default:  return GLYPH_DEFAULT;
+    }
+}
+
+// TEXT RUN
+void TextRun::reset(int w, int h) {
+    rows = h;
+    width = w;
+    strips = (w + 31) / 32;
+    bits.assign(static_cast<size_t>(strips) * rows, 0);
+}
+
+void TextRun::clearColumns(int x0, int x1) {
+    for(int x = x0; x < x1 && x < width; x++) {
+        Uint32 keep = ~(1u << (x % 32));
+        Uint32* strip = &bits[static_cast<size_t>(x / 32) * rows];
+        for(int r = 0; r < rows; r++) strip[r] &= keep;
+    }
+}
+
+void TextRun::orRow(int x, int r, Uint32 mask) {
+    int s = x / 32;
+    int shift = x % 32;
+    if(s < strips) bits[static_cast<size_t>(s) * rows + r] |= mask << shift;
+    if(shift != 0 && s + 1 < strips) bits[static_cast<size_t>(s + 1) * rows + r] |= mask >> (32 - shift);
+}
+
 // DRAW LARGE TEXT
 void FontRenderer::drawLarge(SDL_Plotter& g, int x, int y, color c, const std::string& text, int flashTimer) {
-    const int letterWidth = 30;
-
-    for(size_t i = 0; i < text.size(); ++i) {
-        char ch = toupper(text[i]);
-        if(ch == ' ') { x += letterWidth / 8; continue; }
-        int charX = x + i * letterWidth;
-
-        if(flashTimer != 0 && flashTimer % 20 < 10) continue;
-
-        switch(ch) {
-            case 'A':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'B':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'C':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'D':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 15 - thick, y + py, c); }
-                break;
-            case 'E':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 10; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'F':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 10; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'G':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 10; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'H':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c); }
-                break;
-            case 'I':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 4; px < 14; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 4; px < 14; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 9 - thick, y + py, c); }
-                break;
-            case 'J':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 4; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 14, y + py, c);
-                for(int px = 0; px < 14; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case 'K':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c); }
-                break;
-            case 'L':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case 'M':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 18; py++) g.plotPixel(charX + 8 + thick, y + py, c); }
-                break;
-            case 'N':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 2 + py / 2, y + py, c); }
-                break;
-            case 'O':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'P':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 6; px < 17; px++) g.plotPixel(charX + px, y + 20 + thick, c); }
-                break;
-            case 'Q':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 32; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 12; px < 18; px++) g.plotPixel(charX + px, y + 32 + thick, c); }
-                break;
-            case 'R':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 6; px < 17; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 12 + (py - 20) / 4 + thick / 2, y + py, c); }
-                break;
-            case 'S':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 16; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 4; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case 'T':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 9 - thick, y + py, c); }
-                break;
-            case 'U':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case 'V':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 32; py++) g.plotPixel(charX + 0 + (py - 4) / 4 + thick, y + py, c);
-                for(int py = 4; py < 32; py++) g.plotPixel(charX + 17 - (py - 4) / 4 - thick, y + py, c); }
-                break;
-            case 'W':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int i = 0; i < 10; i++) g.plotPixel(charX + 3 + i, y + 22 + i / 2, c);
-                for(int i = 0; i < 10; i++) g.plotPixel(charX + 14 - i, y + 22 + i / 2, c); }
-                break;
-            case 'X':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) { int px = (py - 4) * 17 / 32 + thick; if(px >= 0 && px < 18) g.plotPixel(charX + px, y + py, c); }
-                for(int py = 4; py < 36; py++) { int px = 17 - (py - 4) * 17 / 32 + thick / 2; if(px >= 0 && px < 18) g.plotPixel(charX + px, y + py, c); } }
-                break;
-            case 'Y':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 2 + thick, y + py, c);
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 16 - thick, y + py, c);
-                for(int py = 16; py < 36; py++) g.plotPixel(charX + 9 + thick / 2, y + py, c); }
-                break;
-            case 'Z':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c); }
-                break;
-            case ':':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 26 + thick, c); }
-                break;
-            case '.':
-                for(int thick = 0; thick < 3; thick++)
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 32 + thick, c);
-                break;
-            case '!':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 30; py++) g.plotPixel(charX + 9 - thick, y + py, c);
-                for(int px = 6; px < 12; px++) g.plotPixel(charX + px, y + 34 + thick, c); }
-                break;
-            case '/':
-                for(int thick = 0; thick < 3; thick++)
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c);
-                break;
-            case '=':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 12 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 24 + thick, c); }
-                break;
-            case '0':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '1':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 8 + thick, y + py, c);
-                for(int px = 4; px < 12; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case '2':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case '3':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '4':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '5':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 20; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            case '6':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 20; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '7':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - (py - 4) / 4, y + py, c); }
-                break;
-            case '8':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c); }
-                break;
-            case '9':
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 20 + thick, c);
-                for(int py = 4; py < 22; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 4; py < 36; py++) g.plotPixel(charX + 17 - thick, y + py, c);
-                for(int px = 0; px < 18; px++) g.plotPixel(charX + px, y + 36 - thick, c); }
-                break;
-            default:
-                for(int thick = 0; thick < 3; thick++) {
-                for(int px = 2; px < 16; px++) g.plotPixel(charX + px, y + 8 + thick, c);
-                for(int px = 2; px < 16; px++) g.plotPixel(charX + px, y + 32 - thick, c);
-                for(int py = 8; py < 32; py++) g.plotPixel(charX + 2 + thick, y + py, c);
-                for(int py = 8; py < 32; py++) g.plotPixel(charX + 15 - thick, y + py, c); }
-                break;
-        }
-    }
+    drawText(g, x, y, c, text.c_str(), FONT_LARGE, flashTimer);
+}
+
+void FontRenderer::drawLarge(SDL_Plotter& g, int x, int y, color c, const char* text, int flashTimer) {
+    drawText(g, x, y, c, text, FONT_LARGE, flashTimer);
 }
 
 // DRAW SMALL TEXT
 void FontRenderer::drawSmall(SDL_Plotter& g, int x, int y, color c, const string& text, int flashTimer) {
-    const int smallWidth = 15;
-
-    for(size_t i = 0; i < text.size(); ++i) {
-        char ch = toupper(text[i]);
-        if(ch == ' ') { x += smallWidth / 2; continue; }
-        int charX = x + i * smallWidth;
-
-        if(flashTimer != 0 && flashTimer % 30 < 15) continue;
-
-        switch(ch) {
-            case 'A':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case 'B':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 7 - thick, y + py, c);
-                for(int py = 10; py < 18; py++) g.plotPixel(charX + 7 - thick, y + py, c); }
-                break;
-            case 'C':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'D':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 7, y + py, c); }
-                break;
-            case 'E':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 5; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'F':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 5; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c); }
-                break;
-            case 'G':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 5; px < 8; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 7 - thick, y + py, c); }
-                break;
-            case 'H':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c); }
-                break;
-            case 'I':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 3 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 4, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 5 - thick, y + py, c); }
-                break;
-            case 'J':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 2; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case 'K':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 8 - (py - 2), y + py, c);
-                for(int py = 10; py < 18; py++) g.plotPixel(charX + 0 + (py - 10), y + py, c); }
-                break;
-            case 'L':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case 'M':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 4 - thick, y + py, c); }
-                break;
-            case 'N':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 1 + (py - 2) / 2, y + py, c); }
-                break;
-            case 'O':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case 'P':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 3; px < 8; px++) g.plotPixel(charX + px, y + 10 + thick, c); }
-                break;
-            case 'Q':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 15; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 6; px < 9; px++) g.plotPixel(charX + px, y + 15 + thick, c); }
-                break;
-            case 'R':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 3; px < 8; px++) g.plotPixel(charX + px, y + 10 + thick, c);
-                for(int py = 10; py < 18; py++) g.plotPixel(charX + 6 + (py - 10) / 3, y + py, c); }
-                break;
-            case 'S':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 4; px++) g.plotPixel(charX + px, y + 8 + thick, c);
-                for(int px = 5; px < 9; px++) g.plotPixel(charX + px, y + 10 + thick, c); }
-                break;
-            case 'T':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 4 - thick, y + py, c); }
-                break;
-            case 'U':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case 'V':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 13; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 13; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 13; py < 18; py++) g.plotPixel(charX + 4 + (py - 13), y + py, c); }
-                break;
-            case 'W':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 4 - thick, y + py, c);
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 12; py < 18; py++) g.plotPixel(charX + 2 + thick, y + py, c);
-                for(int py = 12; py < 18; py++) g.plotPixel(charX + 6 - thick, y + py, c); }
-                break;
-            case 'X':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 18; py++) { int px = (py - 2) * 8 / 16 + thick; if(px >= 0 && px < 9) g.plotPixel(charX + px, y + py, c); }
-                for(int py = 2; py < 18; py++) { int px = 8 - (py - 2) * 8 / 16 + thick / 2; if(px >= 0 && px < 9) g.plotPixel(charX + px, y + py, c); } }
-                break;
-            case 'Y':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 4 - thick, y + py, c); }
-                break;
-            case 'Z':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c); }
-                break;
-            case ':':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 5 + thick, c);
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 13 + thick, c); }
-                break;
-            case '.':
-                for(int thick = 0; thick < 2; thick++)
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 15 + thick, c);
-                break;
-            case '!':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 13; py++) g.plotPixel(charX + 4 - thick, y + py, c);
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 14 + thick, c);
-                for(int px = 3; px < 6; px++) g.plotPixel(charX + px, y + 17, c); }
-                break;
-            case '/':
-                for(int thick = 0; thick < 2; thick++)
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c);
-                break;
-            case '=':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 6 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 12 + thick, c); }
-                break;
-            case '0':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '1':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 1; px < 4; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 16; py++) g.plotPixel(charX + 4 - thick, y + py, c);
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case '2':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 9; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case '3':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '4':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '5':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 10; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            case '6':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 9; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '7':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - (py - 2) / 2, y + py, c); }
-                break;
-            case '8':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c); }
-                break;
-            case '9':
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 2 + thick, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 9 + thick, c);
-                for(int py = 2; py < 11; py++) g.plotPixel(charX + 0 + thick, y + py, c);
-                for(int py = 2; py < 18; py++) g.plotPixel(charX + 8 - thick, y + py, c);
-                for(int px = 0; px < 9; px++) g.plotPixel(charX + px, y + 16 - thick, c); }
-                break;
-            default:
-                for(int thick = 0; thick < 2; thick++) {
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 4 + thick, c);
-                for(int px = 1; px < 8; px++) g.plotPixel(charX + px, y + 16 - thick, c);
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 1 + thick, y + py, c);
-                for(int py = 4; py < 16; py++) g.plotPixel(charX + 7 - thick, y + py, c); }
-                break;
+    drawText(g, x, y, c, text.c_str(), FONT_SMALL, flashTimer);
+}
+
+void FontRenderer::drawSmall(SDL_Plotter& g, int x, int y, color c, const char* text, int flashTimer) {
+    drawText(g, x, y, c, text, FONT_SMALL, flashTimer);
+}
+
+// DRAW TEXT
+void FontRenderer::drawText(SDL_Plotter& g, int x, int y, color c, const char* text,
+                            FontSize font, int flashTimer) {
+    if(isFlashHidden(flashTimer, font)) return;
+
+    drawRun(g, x, y, c, getCache().lookup(text, font));
+}
+
+// MEASURE TEXT
+int FontRenderer::measureText(const char* text, FontSize font) {
+    const FontFace& face = faceFor(font);
+
+    int penX = 0;
+    int width = 0;
+    for(const char* p = text; *p; ++p) {
+        char ch = toupper(*p);
+        if(ch == ' ') { penX += face.advance + face.spaceAdvance; continue; }
+
+        int right = penX + face.atlas[glyphIndex(ch)].width;
+        if(right > width) width = right;
+        penX += face.advance;
+    }
+    return width;
+}
+
+// LINE HEIGHT
+int FontRenderer::getLineHeight(FontSize font) {
+    return faceFor(font).rows;
+}
+
+// GLYPH ADVANCE
+int FontRenderer::getAdvance(FontSize font) {
+    return faceFor(font).advance;
+}
+
+// FLASH - whole string hidden during the off half of the cycle
+bool FontRenderer::isFlashHidden(int flashTimer, FontSize font) {
+    const FontFace& face = faceFor(font);
+    return flashTimer != 0 && flashTimer % face.flashPeriod < face.flashPeriod / 2;
+}
+
+// RASTERIZE STRING
+void FontRenderer::rasterize(const char* text, FontSize font, TextRun& run) {
+    const FontFace& face = faceFor(font);
+    run.reset(measureText(text, font), face.rows);
+
+    int penX = 0;
+    for(const char* p = text; *p; ++p) {
+        char ch = toupper(*p);
+        if(ch == ' ') { penX += face.advance + face.spaceAdvance; continue; }
+
+        rasterizeGlyph(ch, font, penX, run);
+        penX += face.advance;
+    }
+}
+
+// RASTERIZE ONE GLYPH
+void FontRenderer::rasterizeGlyph(char ch, FontSize font, int penX, TextRun& run) {
+    const FontFace& face = faceFor(font);
+    const GlyphBitmap& glyph = face.atlas[glyphIndex(toupper(ch))];
+
+    for(int r = 0; r < face.rows && r < run.rows; r++) {
+        if(glyph.rows[r] != 0) run.orRow(penX, r, glyph.rows[r]);
+    }
+}
+
+// SCALE TO CACHE KEY - quantized to 1/GLYPH_SCALE_STEPS, clamped to [1/16, 16]
+static int scaleSteps(float scale) {
+    int steps = static_cast<int>(scale * GLYPH_SCALE_STEPS + 0.5f);
+    if(steps < 1) steps = 1;
+    if(steps > 16 * GLYPH_SCALE_STEPS) steps = 16 * GLYPH_SCALE_STEPS;
+    return steps;
+}
+
+// DRAW SCALED TEXT - every glyph is a cached blit after first use
+void FontRenderer::drawScaled(SDL_Plotter& g, int x, int y, color c, const char* text,
+                              float scale, int flashTimer) {
+    if(isFlashHidden(flashTimer, FONT_LARGE)) return;
+
+    int steps = scaleSteps(scale);
+    int advance = (LARGE_FACE.advance * steps + GLYPH_SCALE_STEPS / 2) / GLYPH_SCALE_STEPS;
+    int space = (LARGE_FACE.spaceAdvance * steps + GLYPH_SCALE_STEPS / 2) / GLYPH_SCALE_STEPS;
+    GlyphCache& cache = getGlyphCache();
+
+    int penX = x;
+    for(const char* p = text; *p; ++p) {
+        char ch = toupper(*p);
+        if(ch == ' ') { penX += advance + space; continue; }
+
+        drawRun(g, penX, y, c, cache.lookup(ch, steps));
+        penX += advance;
+    }
+}
+
+// MEASURE SCALED TEXT
+int FontRenderer::measureScaled(const char* text, float scale) {
+    int steps = scaleSteps(scale);
+    int advance = (LARGE_FACE.advance * steps + GLYPH_SCALE_STEPS / 2) / GLYPH_SCALE_STEPS;
+    int space = (LARGE_FACE.spaceAdvance * steps + GLYPH_SCALE_STEPS / 2) / GLYPH_SCALE_STEPS;
+
+    int penX = 0;
+    int width = 0;
+    for(const char* p = text; *p; ++p) {
+        char ch = toupper(*p);
+        if(ch == ' ') { penX += advance + space; continue; }
+
+        int glyphWidth = LARGE_FACE.atlas[glyphIndex(ch)].width;
+        int right = penX + (glyphWidth * steps + GLYPH_SCALE_STEPS - 1) / GLYPH_SCALE_STEPS;
+        if(right > width) width = right;
+        penX += advance;
+    }
+    return width;
+}
+
+// SCALED LINE HEIGHT - large-face rows at the quantized scale
+int FontRenderer::getScaledLineHeight(float scale) {
+    return (LARGE_FACE.rows * scaleSteps(scale) + GLYPH_SCALE_STEPS - 1) / GLYPH_SCALE_STEPS;
+}
+
+// RESAMPLE MASTER GLYPH - a target pixel is set if any master pixel under
+// its footprint is set, so thin strokes survive downscaling
+void FontRenderer::rasterizeScaledGlyph(char ch, int scaleSteps, TextRun& run) {
+    const GlyphBitmap& glyph = LARGE_FACE.atlas[glyphIndex(toupper(ch))];
+    const int S = GLYPH_SCALE_STEPS;
+    int width = (glyph.width * scaleSteps + S - 1) / S;
+    int rows = (LARGE_FACE.rows * scaleSteps + S - 1) / S;
+    run.reset(width, rows);
+
+    for(int oy = 0; oy < rows; oy++) {
+        int sy0 = oy * S / scaleSteps;
+        int sy1 = ((oy + 1) * S + scaleSteps - 1) / scaleSteps;
+        if(sy1 <= sy0) sy1 = sy0 + 1;
+        if(sy1 > LARGE_FACE.rows) sy1 = LARGE_FACE.rows;
+
+        Uint32 source = 0;
+        for(int sy = sy0; sy < sy1; sy++) source |= glyph.rows[sy];
+        if(source == 0) continue;
+
+        for(int ox = 0; ox < width; ox++) {
+            int sx0 = ox * S / scaleSteps;
+            int sx1 = ((ox + 1) * S + scaleSteps - 1) / scaleSteps;
+            if(sx1 <= sx0) sx1 = sx0 + 1;
+            if(sx0 >= 32) break;
+            Uint32 span = sx1 - sx0 >= 32 ? ~0u : (1u << (sx1 - sx0)) - 1;
+            if((source >> sx0) & span) run.orRow(ox, oy, 1u);
         }
     }
 }
+
+// BLIT RUN - one mask blit per 32-column strip
+void FontRenderer::drawRun(SDL_Plotter& g, int x, int y, color c, const TextRun& run) {
+    DrawSourceScope scope(g, SOURCE_FONT);
+    for(int s = 0; s < run.strips; s++) {
+        int stripWidth = run.width - s * 32 < 32 ? run.width - s * 32 : 32;
+        g.plotMask(x + s * 32, y, &run.bits[static_cast<size_t>(s) * run.rows],
+                   run.rows, stripWidth, c);
+    }
+}
+
+// SHARED CACHE (one per thread, so offline renderers can draw in parallel)
+TextCache& FontRenderer::getCache() {
+    static thread_local TextCache cache(TEXT_CACHE_BYTES, TEXT_CACHE_SLOTS);
+    return cache;
+}
+
+// SHARED SCALED-GLYPH CACHE (one per thread)
+GlyphCache& FontRenderer::getGlyphCache() {
+    static thread_local GlyphCache cache(GLYPH_CACHE_BYTES, GLYPH_CACHE_SLOTS);
+    return cache;
+}
@@ -9,14 +9,90 @@
 
 #include "SDL_Plotter.h"
 #include <string>
+#include <vector>
+
+enum FontSize {
+    FONT_LARGE,
+    FONT_SMALL
+};
+
+// PRE-RASTERIZED STRING (1 bit per pixel)
+// Stored as 32-column strips; strip s holds `rows` masks starting at bits[s * rows].
+struct TextRun {
+    int rows = 0;                // Height in pixels
+    int width = 0;               // Width in pixels
+    int strips = 0;              // Number of 32-column strips
+    std::vector<Uint32> bits;    // Strip-major row masks
+
+    // Resize to hold width x height pixels, all clear
+    void reset(int w, int h);
+
+    // Clear columns [x0, x1)
+    void clearColumns(int x0, int x1);
+
+    // OR a glyph row mask into row r starting at column x
+    void orRow(int x, int r, Uint32 mask);
+
+    // Bytes held by the mask
+    size_t byteSize() const { return bits.size() * sizeof(Uint32); }
+};
+
+class TextCache;
+class GlyphCache;
 
 class FontRenderer {
 public:
 	// LARGE TEXT
     static void drawLarge(SDL_Plotter& g, int x, int y, color c, const string& text, int flashTimer = 0);
+    static void drawLarge(SDL_Plotter& g, int x, int y, color c, const char* text, int flashTimer = 0);
 
     // SMALL TEXT
     static void drawSmall(SDL_Plotter& g, int x, int y, color c, const string& text, int flashTimer = 0);
+    static void drawSmall(SDL_Plotter& g, int x, int y, color c, const char* text, int flashTimer = 0);
+
+    // TEXT IN EITHER FONT (served from the shared text-run cache)
+    static void drawText(SDL_Plotter& g, int x, int y, color c, const char* text,
+                         FontSize font, int flashTimer = 0);
+
+    // INK WIDTH OF A STRING IN PIXELS
+    static int measureText(const char* text, FontSize font);
+
+    // HEIGHT OF ONE LINE IN PIXELS
+    static int getLineHeight(FontSize font);
+
+    // PEN ADVANCE OF ONE NON-SPACE GLYPH
+    static int getAdvance(FontSize font);
+
+    // FLASH PHASE CHECK (true while text is hidden)
+    static bool isFlashHidden(int flashTimer, FontSize font);
+
+    // RASTERIZE A WHOLE STRING INTO A RUN
+    static void rasterize(const char* text, FontSize font, TextRun& run);
+
+    // OR ONE GLYPH INTO A RUN AT PEN POSITION penX
+    static void rasterizeGlyph(char ch, FontSize font, int penX, TextRun& run);
+
+    // BLIT A RUN
+    static void drawRun(SDL_Plotter& g, int x, int y, color c, const TextRun& run);
+
+    // SHARED TEXT-RUN CACHE
+    static TextCache& getCache();
+
+    // TEXT AT ANY SCALE OF THE MASTER (LARGE) GLYPHS, 1.0 = FONT_LARGE
+    static void drawScaled(SDL_Plotter& g, int x, int y, color c, const char* text,
+                           float scale, int flashTimer = 0);
+
+    // INK WIDTH OF A STRING DRAWN WITH drawScaled
+    static int measureScaled(const char* text, float scale);
+
+    // HEIGHT OF ONE LINE DRAWN WITH drawScaled
+    static int getScaledLineHeight(float scale);
+
+    // RESAMPLE ONE MASTER GLYPH TO scaleSteps / GLYPH_SCALE_STEPS
+    static void rasterizeScaledGlyph(char ch, int scaleSteps, TextRun& run);
+
+    // SHARED SCALED-GLYPH CACHE
+    static GlyphCache& getGlyphCache();
 };
 
 #endif /* FONT_H_ */
@@ -0,0 +1,691 @@
+//================================================================
+// FontGlyphs.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Glyph Atlas
+// Description: Stroke definitions for the large and small pixel
+//              fonts, rasterized to 1-bit-per-pixel bitmaps at
+//              compile time
+//================================================================
+
+#ifndef FontGlyphs_h
+#define FontGlyphs_h
+
+#include <cstddef>
+#include <cstdint>
+
+// ATLAS LAYOUT
+const int GLYPH_MAX_ROWS   = 37;  // Tallest glyph cell (large font)
+const int GLYPH_COUNT      = 42;  // A-Z, : . ! / =, 0-9, fallback box
+const int GLYPH_COLON      = 26;
+const int GLYPH_PERIOD     = 27;
+const int GLYPH_BANG       = 28;
+const int GLYPH_SLASH      = 29;
+const int GLYPH_EQUALS     = 30;
+const int GLYPH_DIGIT_0    = 31;
+const int GLYPH_DEFAULT    = 41;
+
+const int LARGE_GLYPH_ROWS = 37;
+const int LARGE_PEN        = 3;   // Stroke thickness passes
+const int SMALL_GLYPH_ROWS = 18;
+const int SMALL_PEN        = 2;
+
+// ONE ROW OF BITS PER SCANLINE, BIT k = COLUMN k
+struct GlyphBitmap {
+    uint32_t rows[GLYPH_MAX_ROWS];  // Row masks, unused rows are zero
+    int      width;                 // Ink width in pixels
+};
+
+// STROKE PRIMITIVES
+// Each stroke is drawn once per pen pass t = 0 .. pen-1.
+enum GlyphStrokeKind {
+    STROKE_HLINE,   // Row y0 + t*thickNum, columns [x0, x1)
+    STROKE_SLOPE,   // Rows [y0, y1), column x0 + sign*((py-origin)*num/den) + t*thickNum/thickDen
+    STROKE_HSLOPE   // Columns x0 + sign*i, row y0 + i/den, for i in [0, x1)
+};
+
+struct GlyphStroke {
+    int kind;
+    int x0, x1, y0, y1;
+    int origin, sign, num, den;
+    int thickNum, thickDen;
+    int clip;       // If > 0, only columns in [0, clip) are drawn
+};
+
+constexpr GlyphStroke hline(int x0, int x1, int y, int thick) {
+    return GlyphStroke{ STROKE_HLINE, x0, x1, y, y, 0, 1, 0, 1, thick, 1, 0 };
+}
+
+constexpr GlyphStroke vline(int x, int y0, int y1, int thick) {
+    return GlyphStroke{ STROKE_SLOPE, x, x, y0, y1, 0, 1, 0, 1, thick, 1, 0 };
+}
+
+constexpr GlyphStroke slope(int x, int y0, int y1, int origin, int sign, int num, int den,
+                            int thickNum, int thickDen, int clip) {
+    return GlyphStroke{ STROKE_SLOPE, x, x, y0, y1, origin, sign, num, den, thickNum, thickDen, clip };
+}
+
+constexpr GlyphStroke hslope(int x, int y, int length, int sign, int den) {
+    return GlyphStroke{ STROKE_HSLOPE, x, length, y, y, 0, sign, 1, den, 0, 1, 0 };
+}
+
+// COMPILE-TIME RASTERIZER
+// Written as single-expression recursion so it stays valid C++11 constexpr.
+
+constexpr uint32_t spanBits(int x0, int x1) {
+    return x0 >= x1 ? 0u : ((1u << x0) | spanBits(x0 + 1, x1));
+}
+
+constexpr uint32_t columnBit(const GlyphStroke& s, int col) {
+    return (s.clip <= 0 || (col >= 0 && col < s.clip)) ? (1u << col) : 0u;
+}
+
+constexpr uint32_t hslopeBits(const GlyphStroke& s, int py, int i) {
+    return i >= s.x1 ? 0u
+                     : ((py == s.y0 + i / s.den ? (1u << (s.x0 + s.sign * i)) : 0u) |
+                        hslopeBits(s, py, i + 1));
+}
+
+// Bits of scanline py covered by one pen pass t of a stroke
+constexpr uint32_t strokePassBits(const GlyphStroke& s, int py, int t) {
+    return s.kind == STROKE_HLINE
+               ? (py == s.y0 + t * s.thickNum ? spanBits(s.x0, s.x1) : 0u)
+         : s.kind == STROKE_SLOPE
+               ? (py >= s.y0 && py < s.y1
+                      ? columnBit(s, s.x0 + s.sign * ((py - s.origin) * s.num / s.den) +
+                                     t * s.thickNum / s.thickDen)
+                      : 0u)
+               : (t == 0 ? hslopeBits(s, py, 0) : 0u);
+}
+
+constexpr uint32_t strokeBits(const GlyphStroke& s, int py, int t) {
+    return t < 0 ? 0u : (strokePassBits(s, py, t) | strokeBits(s, py, t - 1));
+}
+
+constexpr uint32_t rowBits(const GlyphStroke* s, size_t n, int py, int pen) {
+    return n == 0 ? 0u : (strokeBits(s[0], py, pen - 1) | rowBits(s + 1, n - 1, py, pen));
+}
+
+constexpr uint32_t allRowBits(const GlyphStroke* s, size_t n, int pen, int py, int rows) {
+    return py >= rows ? 0u : (rowBits(s, n, py, pen) | allRowBits(s, n, pen, py + 1, rows));
+}
+
+constexpr int bitLength(uint32_t bits) {
+    return bits == 0 ? 0 : 1 + bitLength(bits >> 1);
+}
+
+template<int... I> struct RowIndices {};
+template<int N, int... I> struct MakeRowIndices : MakeRowIndices<N - 1, N - 1, I...> {};
+template<int... I> struct MakeRowIndices<0, I...> { typedef RowIndices<I...> type; };
+
+template<int Pen, int... I>
+constexpr GlyphBitmap rasterize(const GlyphStroke* s, size_t n, RowIndices<I...>) {
+    return GlyphBitmap{ { rowBits(s, n, I, Pen)... },
+                        bitLength(allRowBits(s, n, Pen, 0, sizeof...(I))) };
+}
+
+template<int Rows, int Pen, size_t N>
+constexpr GlyphBitmap glyph(const GlyphStroke (&s)[N]) {
+    return rasterize<Pen>(s, N, typename MakeRowIndices<Rows>::type());
+}
+
+// LARGE FONT STROKES (30 px cell, 3 px pen)
+constexpr GlyphStroke LARGE_A[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 20, 1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_B[] = {
+    hline(0, 16, 4, 1),
+    hline(0, 16, 20, 1),
+    hline(0, 16, 36, -1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 22, -1),
+    vline(17, 20, 36, -1)
+};
+constexpr GlyphStroke LARGE_C[] = {
+    hline(0, 16, 4, 1),
+    hline(0, 16, 36, -1),
+    vline(0, 4, 36, 1)
+};
+constexpr GlyphStroke LARGE_D[] = {
+    hline(0, 16, 4, 1),
+    hline(0, 16, 36, -1),
+    vline(0, 4, 36, 1),
+    vline(15, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_E[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 10, 20, 1),
+    hline(0, 18, 36, -1),
+    vline(0, 4, 36, 1)
+};
+constexpr GlyphStroke LARGE_F[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 10, 20, 1),
+    vline(0, 4, 36, 1)
+};
+constexpr GlyphStroke LARGE_G[] = {
+    hline(0, 16, 4, 1),
+    hline(0, 18, 36, -1),
+    vline(0, 4, 36, 1),
+    hline(10, 18, 20, 1),
+    vline(17, 20, 36, -1)
+};
+constexpr GlyphStroke LARGE_H[] = {
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1),
+    hline(0, 18, 20, 1)
+};
+constexpr GlyphStroke LARGE_I[] = {
+    hline(4, 14, 4, 1),
+    hline(4, 14, 36, -1),
+    vline(9, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_J[] = {
+    hline(4, 18, 4, 1),
+    vline(14, 4, 36, 0),
+    hline(0, 14, 36, -1)
+};
+constexpr GlyphStroke LARGE_K[] = {
+    vline(0, 4, 36, 1),
+    vline(17, 4, 20, -1),
+    vline(17, 20, 36, -1),
+    hline(0, 18, 20, 1)
+};
+constexpr GlyphStroke LARGE_L[] = {
+    vline(0, 4, 36, 1),
+    hline(0, 18, 36, -1)
+};
+constexpr GlyphStroke LARGE_M[] = {
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1),
+    hline(0, 18, 4, 1),
+    vline(8, 4, 18, 1)
+};
+constexpr GlyphStroke LARGE_N[] = {
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1),
+    slope(2, 4, 36, 0, 1, 1, 2, 0, 1, 0)
+};
+constexpr GlyphStroke LARGE_O[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 36, -1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_P[] = {
+    hline(0, 18, 4, 1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 22, -1),
+    hline(6, 17, 20, 1)
+};
+constexpr GlyphStroke LARGE_Q[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 36, -1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 32, -1),
+    hline(12, 18, 32, 1)
+};
+constexpr GlyphStroke LARGE_R[] = {
+    hline(0, 18, 4, 1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 22, -1),
+    hline(6, 17, 20, 1),
+    slope(12, 20, 36, 20, 1, 1, 4, 1, 2, 0)
+};
+constexpr GlyphStroke LARGE_S[] = {
+    hline(0, 16, 4, 1),
+    hline(0, 16, 20, 1),
+    hline(4, 18, 36, -1),
+    vline(0, 4, 20, 1),
+    vline(17, 20, 36, -1)
+};
+constexpr GlyphStroke LARGE_T[] = {
+    hline(0, 18, 4, 1),
+    vline(9, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_U[] = {
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1),
+    hline(0, 18, 36, -1)
+};
+constexpr GlyphStroke LARGE_V[] = {
+    slope(0, 4, 32, 4, 1, 1, 4, 1, 1, 0),
+    slope(17, 4, 32, 4, -1, 1, 4, -1, 1, 0)
+};
+constexpr GlyphStroke LARGE_W[] = {
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1),
+    hslope(3, 22, 10, 1, 2),
+    hslope(14, 22, 10, -1, 2)
+};
+constexpr GlyphStroke LARGE_X[] = {
+    slope(0, 4, 36, 4, 1, 17, 32, 1, 1, 18),
+    slope(17, 4, 36, 4, -1, 17, 32, 1, 2, 18)
+};
+constexpr GlyphStroke LARGE_Y[] = {
+    vline(2, 4, 16, 1),
+    vline(16, 4, 16, -1),
+    slope(9, 16, 36, 0, 1, 0, 1, 1, 2, 0)
+};
+constexpr GlyphStroke LARGE_Z[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 36, -1),
+    slope(17, 4, 36, 4, -1, 1, 4, 0, 1, 0)
+};
+constexpr GlyphStroke LARGE_COLON[] = {
+    hline(6, 12, 10, 1),
+    hline(6, 12, 26, 1)
+};
+constexpr GlyphStroke LARGE_PERIOD[] = {
+    hline(6, 12, 32, 1)
+};
+constexpr GlyphStroke LARGE_BANG[] = {
+    vline(9, 4, 30, -1),
+    hline(6, 12, 34, 1)
+};
+constexpr GlyphStroke LARGE_SLASH[] = {
+    slope(17, 4, 36, 4, -1, 1, 4, 0, 1, 0)
+};
+constexpr GlyphStroke LARGE_EQUALS[] = {
+    hline(0, 18, 12, 1),
+    hline(0, 18, 24, 1)
+};
+constexpr GlyphStroke LARGE_0[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 36, -1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_1[] = {
+    vline(8, 4, 36, 1),
+    hline(4, 12, 36, -1)
+};
+constexpr GlyphStroke LARGE_2[] = {
+    hline(0, 18, 4, 1),
+    vline(17, 4, 20, -1),
+    hline(0, 18, 20, 1),
+    vline(0, 20, 36, 1),
+    hline(0, 18, 36, -1)
+};
+constexpr GlyphStroke LARGE_3[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 20, 1),
+    hline(0, 18, 36, -1),
+    vline(17, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_4[] = {
+    vline(0, 4, 20, 1),
+    hline(0, 18, 20, 1),
+    vline(17, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_5[] = {
+    hline(0, 18, 4, 1),
+    vline(0, 4, 20, 1),
+    hline(0, 18, 20, 1),
+    vline(17, 20, 36, -1),
+    hline(0, 18, 36, -1)
+};
+constexpr GlyphStroke LARGE_6[] = {
+    hline(0, 18, 4, 1),
+    vline(0, 4, 36, 1),
+    hline(0, 18, 20, 1),
+    hline(0, 18, 36, -1),
+    vline(17, 20, 36, -1)
+};
+constexpr GlyphStroke LARGE_7[] = {
+    hline(0, 18, 4, 1),
+    slope(17, 4, 36, 4, -1, 1, 4, 0, 1, 0)
+};
+constexpr GlyphStroke LARGE_8[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 20, 1),
+    hline(0, 18, 36, -1),
+    vline(0, 4, 36, 1),
+    vline(17, 4, 36, -1)
+};
+constexpr GlyphStroke LARGE_9[] = {
+    hline(0, 18, 4, 1),
+    hline(0, 18, 20, 1),
+    vline(0, 4, 22, 1),
+    vline(17, 4, 36, -1),
+    hline(0, 18, 36, -1)
+};
+constexpr GlyphStroke LARGE_DEFAULT[] = {
+    hline(2, 16, 8, 1),
+    hline(2, 16, 32, -1),
+    vline(2, 8, 32, 1),
+    vline(15, 8, 32, -1)
+};
+
+// SMALL FONT STROKES (15 px cell, 2 px pen)
+constexpr GlyphStroke SMALL_A[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 10, 1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_B[] = {
+    hline(0, 8, 2, 1),
+    hline(0, 8, 10, 1),
+    hline(0, 8, 16, -1),
+    vline(0, 2, 18, 1),
+    vline(7, 2, 11, -1),
+    vline(7, 10, 18, -1)
+};
+constexpr GlyphStroke SMALL_C[] = {
+    hline(0, 8, 2, 1),
+    hline(0, 8, 16, -1),
+    vline(0, 2, 18, 1)
+};
+constexpr GlyphStroke SMALL_D[] = {
+    hline(0, 8, 2, 1),
+    hline(0, 8, 16, -1),
+    vline(0, 2, 18, 1),
+    vline(7, 2, 18, 0)
+};
+constexpr GlyphStroke SMALL_E[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 5, 9, 1),
+    hline(0, 9, 16, -1),
+    vline(0, 2, 18, 1)
+};
+constexpr GlyphStroke SMALL_F[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 5, 9, 1),
+    vline(0, 2, 18, 1)
+};
+constexpr GlyphStroke SMALL_G[] = {
+    hline(0, 8, 2, 1),
+    hline(0, 8, 16, -1),
+    vline(0, 2, 18, 1),
+    hline(5, 8, 9, 1),
+    vline(7, 9, 18, -1)
+};
+constexpr GlyphStroke SMALL_H[] = {
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1),
+    hline(0, 9, 9, 1)
+};
+constexpr GlyphStroke SMALL_I[] = {
+    hline(1, 8, 2, 1),
+    hline(1, 8, 16, -1),
+    vline(3, 2, 18, 1),
+    vline(4, 2, 18, 0),
+    vline(5, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_J[] = {
+    hline(2, 9, 2, 1),
+    vline(8, 2, 18, -1),
+    hline(0, 8, 16, -1)
+};
+constexpr GlyphStroke SMALL_K[] = {
+    vline(0, 2, 18, 1),
+    slope(8, 2, 10, 2, -1, 1, 1, 0, 1, 0),
+    slope(0, 10, 18, 10, 1, 1, 1, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_L[] = {
+    vline(0, 2, 18, 1),
+    hline(0, 9, 16, -1)
+};
+constexpr GlyphStroke SMALL_M[] = {
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1),
+    hline(0, 9, 2, 1),
+    vline(4, 2, 10, -1)
+};
+constexpr GlyphStroke SMALL_N[] = {
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1),
+    slope(1, 2, 18, 2, 1, 1, 2, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_O[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 16, -1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_P[] = {
+    hline(0, 9, 2, 1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 11, -1),
+    hline(3, 8, 10, 1)
+};
+constexpr GlyphStroke SMALL_Q[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 16, -1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 15, -1),
+    hline(6, 9, 15, 1)
+};
+constexpr GlyphStroke SMALL_R[] = {
+    hline(0, 9, 2, 1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 11, -1),
+    hline(3, 8, 10, 1),
+    slope(6, 10, 18, 10, 1, 1, 3, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_S[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 9, 1),
+    hline(0, 9, 16, -1),
+    vline(0, 2, 9, 1),
+    vline(8, 9, 18, -1),
+    hline(0, 4, 8, 1),
+    hline(5, 9, 10, 1)
+};
+constexpr GlyphStroke SMALL_T[] = {
+    hline(0, 9, 2, 1),
+    vline(4, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_U[] = {
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1),
+    hline(0, 9, 16, -1)
+};
+constexpr GlyphStroke SMALL_V[] = {
+    vline(0, 2, 13, 1),
+    vline(8, 2, 13, -1),
+    slope(4, 13, 18, 13, 1, 1, 1, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_W[] = {
+    vline(0, 2, 16, 1),
+    vline(4, 2, 16, -1),
+    vline(8, 2, 16, -1),
+    vline(2, 12, 18, 1),
+    vline(6, 12, 18, -1)
+};
+constexpr GlyphStroke SMALL_X[] = {
+    slope(0, 2, 18, 2, 1, 8, 16, 1, 1, 9),
+    slope(8, 2, 18, 2, -1, 8, 16, 1, 2, 9)
+};
+constexpr GlyphStroke SMALL_Y[] = {
+    vline(0, 2, 9, 1),
+    vline(8, 2, 9, -1),
+    vline(4, 9, 18, -1)
+};
+constexpr GlyphStroke SMALL_Z[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 16, -1),
+    slope(8, 2, 18, 2, -1, 1, 2, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_COLON[] = {
+    hline(3, 6, 5, 1),
+    hline(3, 6, 13, 1)
+};
+constexpr GlyphStroke SMALL_PERIOD[] = {
+    hline(3, 6, 15, 1)
+};
+constexpr GlyphStroke SMALL_BANG[] = {
+    vline(4, 2, 13, -1),
+    hline(3, 6, 14, 1),
+    hline(3, 6, 17, 0)
+};
+constexpr GlyphStroke SMALL_SLASH[] = {
+    slope(8, 2, 18, 2, -1, 1, 2, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_EQUALS[] = {
+    hline(0, 9, 6, 1),
+    hline(0, 9, 12, 1)
+};
+constexpr GlyphStroke SMALL_0[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 16, -1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_1[] = {
+    hline(1, 4, 2, 1),
+    vline(4, 2, 16, -1),
+    hline(1, 8, 16, -1)
+};
+constexpr GlyphStroke SMALL_2[] = {
+    hline(0, 9, 2, 1),
+    vline(8, 2, 9, -1),
+    hline(0, 9, 9, 1),
+    vline(0, 9, 18, 1),
+    hline(0, 9, 16, -1)
+};
+constexpr GlyphStroke SMALL_3[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 9, 1),
+    hline(0, 9, 16, -1),
+    vline(8, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_4[] = {
+    vline(0, 2, 10, 1),
+    hline(0, 9, 9, 1),
+    vline(8, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_5[] = {
+    hline(0, 9, 2, 1),
+    vline(0, 2, 10, 1),
+    hline(0, 9, 9, 1),
+    vline(8, 9, 18, -1),
+    hline(0, 9, 16, -1)
+};
+constexpr GlyphStroke SMALL_6[] = {
+    hline(0, 9, 2, 1),
+    vline(0, 2, 18, 1),
+    hline(0, 9, 9, 1),
+    hline(0, 9, 16, -1),
+    vline(8, 9, 18, -1)
+};
+constexpr GlyphStroke SMALL_7[] = {
+    hline(0, 9, 2, 1),
+    slope(8, 2, 18, 2, -1, 1, 2, 0, 1, 0)
+};
+constexpr GlyphStroke SMALL_8[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 9, 1),
+    hline(0, 9, 16, -1),
+    vline(0, 2, 18, 1),
+    vline(8, 2, 18, -1)
+};
+constexpr GlyphStroke SMALL_9[] = {
+    hline(0, 9, 2, 1),
+    hline(0, 9, 9, 1),
+    vline(0, 2, 11, 1),
+    vline(8, 2, 18, -1),
+    hline(0, 9, 16, -1)
+};
+constexpr GlyphStroke SMALL_DEFAULT[] = {
+    hline(1, 8, 4, 1),
+    hline(1, 8, 16, -1),
+    vline(1, 4, 16, 1),
+    vline(7, 4, 16, -1)
+};
+
+// ATLASES (index order matches the GLYPH_* constants)
+constexpr GlyphBitmap LARGE_ATLAS[GLYPH_COUNT] = {
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_A),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_B),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_C),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_D),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_E),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_F),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_G),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_H),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_I),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_J),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_K),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_L),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_M),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_N),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_O),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_P),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_Q),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_R),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_S),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_T),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_U),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_V),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_W),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_X),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_Y),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_Z),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_COLON),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_PERIOD),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_BANG),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_SLASH),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_EQUALS),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_0),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_1),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_2),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_3),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_4),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_5),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_6),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_7),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_8),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_9),
+    glyph<LARGE_GLYPH_ROWS, LARGE_PEN>(LARGE_DEFAULT)
+};
+
+constexpr GlyphBitmap SMALL_ATLAS[GLYPH_COUNT] = {
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_A),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_B),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_C),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_D),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_E),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_F),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_G),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_H),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_I),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_J),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_K),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_L),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_M),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_N),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_O),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_P),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_Q),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_R),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_S),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_T),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_U),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_V),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_W),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_X),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_Y),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_Z),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_COLON),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_PERIOD),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_BANG),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_SLASH),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_EQUALS),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_0),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_1),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_2),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_3),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_4),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_5),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_6),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_7),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_8),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_9),
+    glyph<SMALL_GLYPH_ROWS, SMALL_PEN>(SMALL_DEFAULT)
+};
+
+#endif /* FontGlyphs_h */
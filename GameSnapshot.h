@@ -0,0 +1,88 @@
+//================================================================
+// GameSnapshot.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Game Snapshot
+// Description: Whole race state as one flat, versioned, checksummed
+//              blob, for instant restarts, lap checkpoints and crash
+//              dumps; captured and restored without allocating
+//================================================================
+
+#ifndef GameSnapshot_h
+#define GameSnapshot_h
+
+#include "Simulation.h"
+#include <string>
+#include <vector>
+
+const int SNAPSHOT_HEADER_BYTES = 20;   // Magic, version, state bytes, checksum
+
+class GameSnapshot {
+private:
+    std::vector<Uint8> blob;   // Header then Simulation::saveState(), empty if none
+
+public:
+    /*
+     * Description: Create an empty snapshot
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: isEmpty() true
+     */
+    GameSnapshot() {}
+
+    /*
+     * Description: Store a race's whole state
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Previous contents replaced; allocates only the first
+     *                 time (room is kept for the race at full traffic)
+     */
+    void capture(const Simulation& sim);
+
+    /*
+     * Description: Put a race back in the captured state in one pass
+     * Return: bool - false if empty, from another version, or damaged
+     * Pre-condition: None (a Simulation's entity arrays are reserved for
+     *                full pools, so nothing allocates)
+     * Post-condition: sim continues exactly as the captured race would;
+     *                 header and checksum are checked first, so a snapshot
+     *                 they reject leaves sim untouched
+     */
+    bool restore(Simulation& sim) const;
+
+    /*
+     * Description: Drop the stored state
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: isEmpty() true, capacity kept
+     */
+    void clear() { blob.clear(); }
+
+    /*
+     * Description: Write the blob to a file with plain open/write calls,
+     *              safe from a signal handler (crash dumps)
+     * Return: bool - true if every byte was written
+     * Pre-condition: Not empty
+     * Post-condition: path replaced; no allocation
+     */
+    bool save(const char* path) const;
+
+    /*
+     * Description: Read a blob written by save
+     * Return: bool - true if the file holds a snapshot of this version
+     * Pre-condition: None
+     * Post-condition: Contents replaced, or cleared on failure
+     */
+    bool load(const std::string& path);
+
+    /*
+     * Description: Read-only access
+     * Return: Requested value
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool isEmpty() const { return blob.empty(); }
+    size_t getSize() const { return blob.size(); }
+    const Uint8* getData() const { return blob.data(); }
+};
+
+#endif /* GameSnapshot_h */
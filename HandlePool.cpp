@@ -0,0 +1,93 @@
+//================================================================
+// HandlePool.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Handle Pool Implementation
+// Description: Free list, swap-with-last release, and saved state
+//================================================================
+
+#include "HandlePool.h"
+#include "StateStream.h"
+#include <algorithm>
+
+HandlePool::HandlePool(int maxEntities)
+    : capacity{maxEntities},
+      generation(maxEntities, 0),
+      denseOf(maxEntities, -1)
+{
+    slotOf.reserve(maxEntities);
+    freeSlots.reserve(maxEntities);
+    clear();
+}
+
+// FREE LIST - slots handed out lowest first, so a race always lays its
+// entities out the same way
+EntityHandle HandlePool::acquire() {
+    if(freeSlots.empty()) return EntityHandle();
+    int slot = freeSlots.back();
+    freeSlots.pop_back();
+    denseOf[slot] = getCount();
+    slotOf.push_back(slot);
+    return EntityHandle(slot, generation[slot]);
+}
+
+int HandlePool::release(int index) {
+    int slot = slotOf[index];
+    int last = getCount() - 1;
+    slotOf[index] = slotOf[last];
+    denseOf[slotOf[index]] = index;
+    slotOf.pop_back();
+
+    denseOf[slot] = -1;
+    generation[slot]++;
+    freeSlots.push_back(slot);
+    return last;
+}
+
+void HandlePool::clear() {
+    for(int slot : slotOf) {
+        denseOf[slot] = -1;
+        generation[slot]++;
+    }
+    slotOf.clear();
+    freeSlots.clear();
+    for(int slot = capacity - 1; slot >= 0; slot--) freeSlots.push_back(slot);
+}
+
+void HandlePool::setFreeGeneration(uint32_t firstGeneration) {
+    for(int slot : freeSlots) generation[slot] = firstGeneration;
+}
+
+// SAVED STATE
+void HandlePool::saveState(StateWriter& out) const {
+    out.putArray(generation);
+    out.putArray(slotOf);
+    out.putArray(freeSlots);
+}
+
+void HandlePool::loadState(StateReader& in) {
+    in.getArray(generation);
+    in.getArray(slotOf);
+    in.getArray(freeSlots);
+
+    // EVERY SLOT EITHER LIVE ONCE OR FREE ONCE
+    bool valid = static_cast<int>(generation.size()) == capacity &&
+                 slotOf.size() + freeSlots.size() == static_cast<size_t>(capacity);
+    for(int slot = 0; slot < capacity; slot++) denseOf[slot] = -1;
+    for(int i = 0; valid && i < getCount(); i++) {
+        valid = slotOf[i] >= 0 && slotOf[i] < capacity && denseOf[slotOf[i]] == -1;
+        if(valid) denseOf[slotOf[i]] = i;
+    }
+    for(size_t i = 0; valid && i < freeSlots.size(); i++) {
+        valid = freeSlots[i] >= 0 && freeSlots[i] < capacity && denseOf[freeSlots[i]] == -1;
+        if(valid) denseOf[freeSlots[i]] = -2;   // Marks it seen
+    }
+    if(!valid) {
+        generation.resize(capacity);
+        std::fill(denseOf.begin(), denseOf.end(), -1);
+        slotOf.clear();
+        clear();
+        in.fail();
+        return;
+    }
+    for(int slot : freeSlots) denseOf[slot] = -1;
+}
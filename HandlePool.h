@@ -0,0 +1,126 @@
+//================================================================
+// HandlePool.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Handle Pool
+// Description: Fixed-capacity slot allocator with generational handles
+//              for densely packed entity arrays: O(1) acquire and
+//              release through a free list, stale handles detected
+//================================================================
+
+#ifndef HandlePool_h
+#define HandlePool_h
+
+#include <cstdint>
+#include <vector>
+
+class StateWriter;  // Forward declaration
+class StateReader;  // Forward declaration
+
+// ENTITY HANDLE - a slot and the generation it was handed out in; the
+// slot's generation moves on when the entity is released, so a kept
+// handle stops resolving instead of finding whatever reused the slot
+struct EntityHandle {
+    int      slot;         // -1 for no entity
+    uint32_t generation;
+
+    EntityHandle() : slot{-1}, generation{0} {}
+    EntityHandle(int s, uint32_t g) : slot{s}, generation{g} {}
+    bool isNone() const { return slot < 0; }
+    bool operator==(const EntityHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+class HandlePool {
+private:
+    int                   capacity;    // Slots, fixed at construction
+    std::vector<uint32_t> generation;  // Current generation of each slot
+    std::vector<int>      denseOf;     // Slot -> dense index, -1 when free
+    std::vector<int>      slotOf;      // Dense index -> slot, one per live entity
+    std::vector<int>      freeSlots;   // Stack of free slots, lowest on top
+
+public:
+    /*
+     * Description: Create a pool and allocate all of its bookkeeping
+     * Return: None (constructor)
+     * Pre-condition: maxEntities >= 0
+     * Post-condition: Every slot free; nothing allocates afterwards
+     */
+    explicit HandlePool(int maxEntities);
+
+    /*
+     * Description: Take a free slot for a new entity
+     * Return: EntityHandle - its handle, none if the pool is full
+     * Pre-condition: None
+     * Post-condition: The entity is dense index getCount() - 1 (the caller
+     *                 appends its fields)
+     */
+    EntityHandle acquire();
+
+    /*
+     * Description: Free the entity at a dense index by moving the last
+     *              entity into its place
+     * Return: int - dense index the moved entity came from (the caller
+     *         copies its fields into index, then drops the last entry)
+     * Pre-condition: 0 <= index < getCount()
+     * Post-condition: Its handle is stale; count one lower
+     */
+    int release(int index);
+
+    /*
+     * Description: Free every slot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Count 0; every handle handed out so far is stale
+     */
+    void clear();
+
+    /*
+     * Description: Restart the generation of every free slot
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Live handles unchanged; the next handles of an empty
+     *                 pool depend only on firstGeneration
+     */
+    void setFreeGeneration(uint32_t firstGeneration);
+
+    /*
+     * Description: Resolve a handle
+     * Return: int - dense index, or -1 if the handle is none or stale
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int find(EntityHandle handle) const {
+        if(handle.slot < 0 || handle.slot >= capacity || generation[handle.slot] != handle.generation) return -1;
+        return denseOf[handle.slot];
+    }
+
+    /*
+     * Description: Handle of the entity at a dense index
+     * Return: EntityHandle - current handle
+     * Pre-condition: 0 <= index < getCount()
+     * Post-condition: No state change
+     */
+    EntityHandle handleAt(int index) const { return EntityHandle(slotOf[index], generation[slotOf[index]]); }
+
+    /*
+     * Description: Save or restore every slot's generation and owner
+     * Return: void
+     * Pre-condition: in holds what saveState wrote for a pool of the
+     *                same capacity
+     * Post-condition: Handles resolve as in the saved pool; in fails on a
+     *                 different capacity or inconsistent slots
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
+
+    /*
+     * Description: Pool size
+     * Return: int - live entities or slots
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getCount() const { return static_cast<int>(slotOf.size()); }
+    int getCapacity() const { return capacity; }
+};
+
+#endif /* HandlePool_h */
@@ -0,0 +1,181 @@
+//================================================================
+// JobSystem.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Job System Implementation
+// Description: Worker queues, stealing, sleeping and waking, range
+//              splitting, and dependency counting for job graphs
+//================================================================
+
+#include "JobSystem.h"
+#include <algorithm>
+
+// WORKER OF THE CALLING THREAD - set on each worker thread, so jobs that
+// start nested work push it onto their own worker's queue
+static thread_local const JobSystem* workerSystem = nullptr;
+static thread_local int workerIndex = 0;
+
+JobSystem::JobSystem(int threads)
+    : threadCount{threads},
+      queued{0},
+      sleeping{0},
+      stopping{false},
+      grainEntities{JOB_GRAIN_ENTITIES},
+      parallelEntities{JOB_PARALLEL_ENTITIES}
+{
+    if(threadCount <= 0) threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    if(threadCount <= 0) threadCount = 1;
+
+    queues.reset(new WorkerQueue[threadCount]);
+    for(int i = 0; i < threadCount; i++) queues[i].head = queues[i].tail = 0;
+    for(int i = 1; i < threadCount; i++) {
+        workers.push_back(std::thread(&JobSystem::workerLoop, this, i));
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(auto& w : workers) w.join();
+}
+
+int JobSystem::currentWorker() const {
+    return workerSystem == this ? workerIndex : 0;
+}
+
+// QUEUE A JOB - a full queue runs it on the spot instead
+void JobSystem::push(int worker, const Job& job) {
+    WorkerQueue& queue = queues[worker];
+    bool full;
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        full = queue.tail - queue.head >= JOB_QUEUE_CAPACITY;
+        if(!full) {
+            queue.jobs[queue.tail++ % JOB_QUEUE_CAPACITY] = job;
+            queued++;
+        }
+    }
+    if(full) {
+        job.run(job.body, job.begin, job.end, worker);
+        job.pending->fetch_sub(1);
+        return;
+    }
+
+    // A sleeper counts itself in before checking queued, so one of the
+    // two always sees the other
+    if(sleeping.load() > 0) {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        wake.notify_one();
+    }
+}
+
+// TAKE A JOB - newest from the worker's own queue, else the oldest from
+// the next queue round that has one
+bool JobSystem::take(int worker, Job& job) {
+    for(int k = 0; k < threadCount; k++) {
+        WorkerQueue& queue = queues[(worker + k) % threadCount];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if(queue.tail == queue.head) continue;
+        job = k == 0 ? queue.jobs[--queue.tail % JOB_QUEUE_CAPACITY]
+                     : queue.jobs[queue.head++ % JOB_QUEUE_CAPACITY];
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::runOne(int worker) {
+    Job job;
+    if(!take(worker, job)) return false;
+    job.run(job.body, job.begin, job.end, worker);
+    job.pending->fetch_sub(1);
+    return true;
+}
+
+// WAIT BY WORKING - run queued jobs (any of them) until pending drains
+void JobSystem::wait(int worker, const std::atomic<int>& pending) {
+    while(pending.load() > 0) {
+        if(!runOne(worker)) std::this_thread::yield();
+    }
+}
+
+void JobSystem::workerLoop(int worker) {
+    workerSystem = this;
+    workerIndex = worker;
+    for(;;) {
+        bool ran = false;
+        for(int spin = 0; spin < JOB_IDLE_SPINS && !ran; spin++) {
+            ran = runOne(worker);
+            if(!ran) std::this_thread::yield();
+        }
+        if(ran) continue;
+
+        std::unique_lock<std::mutex> guard(sleepLock);
+        sleeping++;
+        wake.wait(guard, [&]{ return stopping || queued.load() > 0; });
+        sleeping--;
+        if(stopping) return;
+    }
+}
+
+// PARALLEL-FOR - ranges of at least grain, a few per thread so stolen
+// ranges even out uneven work; the caller runs the first itself
+void JobSystem::runRanges(int count, int grain, RangeJob run, const void* body) {
+    if(count <= 0) return;
+    const int worker = currentWorker();
+    const int ranges = std::min((count + grain - 1) / grain, threadCount * JOB_RANGES_PER_THREAD);
+    if(ranges <= 1 || threadCount == 1) {
+        run(body, 0, count, worker);
+        return;
+    }
+
+    std::atomic<int> pending(ranges - 1);
+    auto bound = [&](int r) { return static_cast<int>(static_cast<int64_t>(count) * r / ranges); };
+    for(int r = ranges - 1; r >= 1; r--) {
+        Job job = { run, body, bound(r), bound(r + 1), &pending };
+        push(worker, job);
+    }
+    run(body, 0, bound(1), worker);
+    wait(worker, pending);
+}
+
+// GRAPH - the nodes nothing waits on go in first; each finished node
+// queues the dependents it was the last wait of
+void JobSystem::runGraph(JobGraph& graph) {
+    const int worker = currentWorker();
+    for(int i = graph.count - 1; i >= 0; i--) {
+        if(graph.nodes[i].dependencies > 0) continue;
+        Job job = { &JobGraph::runNode, &graph, i, i + 1, &graph.remaining };
+        push(worker, job);
+    }
+    wait(worker, graph.remaining);
+}
+
+void JobGraph::runNode(const void* graph, int node, int, int worker) {
+    JobGraph& self = *const_cast<JobGraph*>(static_cast<const JobGraph*>(graph));
+    self.nodes[node].run(self.nodes[node].job);
+    for(int d = node + 1; d < self.count; d++) {
+        if((self.nodes[node].dependents >> d & 1) && --self.waiting[d] == 0) {
+            JobSystem::Job job = { &JobGraph::runNode, graph, d, d + 1, &self.remaining };
+            self.system->push(worker, job);
+        }
+    }
+}
+
+void JobGraph::depend(int node, int on) {
+    nodes[on].dependents |= 1u << node;
+    nodes[node].dependencies++;
+}
+
+void JobGraph::run(JobSystem* jobs) {
+    if(!jobs || jobs->getThreadCount() == 1) {
+        for(int i = 0; i < count; i++) nodes[i].run(nodes[i].job);
+        return;
+    }
+    system = jobs;
+    remaining = count;
+    for(int i = 0; i < count; i++) waiting[i] = nodes[i].dependencies;
+    jobs->runGraph(*this);
+}
@@ -0,0 +1,233 @@
+//================================================================
+// JobSystem.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Job System
+// Description: Work-stealing worker threads for fine-grained jobs:
+//              parallel-for over index ranges, and graphs of jobs that
+//              run once the jobs they depend on have finished
+//================================================================
+
+#ifndef JobSystem_h
+#define JobSystem_h
+
+#include "Const.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobGraph;  // Forward declaration
+
+// PER-WORKER SLOT - one value followed by a cache line of padding, so
+// workers writing neighbouring slots never share a line
+template <typename T>
+struct WorkerSlot {
+    T    value;
+    char pad[CACHE_LINE_BYTES];
+};
+
+class JobSystem {
+public:
+    // RANGE JOB - body(begin, end, worker) through a type-erased pointer
+    typedef void (*RangeJob)(const void* body, int begin, int end, int worker);
+
+private:
+    struct Job {
+        RangeJob          run;
+        const void*       body;
+        int               begin, end;
+        std::atomic<int>* pending;   // Count this job finishing takes one off
+    };
+
+    // WORKER QUEUE - the owner pushes and pops at the tail, thieves take
+    // the oldest job at the head; padded so queues never share a line
+    struct WorkerQueue {
+        std::mutex lock;
+        Job        jobs[JOB_QUEUE_CAPACITY];   // Ring, indexed modulo capacity
+        int        head, tail;                 // tail - head jobs queued
+        char       pad[CACHE_LINE_BYTES];
+    };
+
+    std::vector<std::thread>       workers;
+    std::unique_ptr<WorkerQueue[]> queues;     // One per thread, the caller's first
+    int                            threadCount;
+    std::atomic<int>               queued;     // Jobs in all queues
+    std::atomic<int>               sleeping;   // Workers waiting on wake
+    std::mutex                     sleepLock;
+    std::condition_variable        wake;       // Signals queued work or shutdown
+    bool                           stopping;
+    int                            grainEntities;      // Fewest entities in one range
+    int                            parallelEntities;   // Fewest entities worth splitting
+
+    void workerLoop(int worker);
+    int currentWorker() const;
+    void push(int worker, const Job& job);
+    bool take(int worker, Job& job);
+    bool runOne(int worker);
+    void wait(int worker, const std::atomic<int>& pending);
+    void runRanges(int count, int grain, RangeJob run, const void* body);
+    void runGraph(JobGraph& graph);
+
+    template <typename Body>
+    static void callRange(const void* body, int begin, int end, int worker) {
+        (*static_cast<const Body*>(body))(begin, end, worker);
+    }
+
+    friend class JobGraph;
+
+public:
+    /*
+     * Description: Start worker threads, each with its own job queue
+     * Return: None (constructor)
+     * Pre-condition: threads >= 0 (0 = one per hardware thread)
+     * Post-condition: threads - 1 workers waiting; the caller is worker 0
+     */
+    explicit JobSystem(int threads = 0);
+
+    /*
+     * Description: Stop and join all workers
+     * Return: None (destructor)
+     * Pre-condition: No job running
+     * Post-condition: All worker threads joined
+     */
+    ~JobSystem();
+
+    /*
+     * Description: Run body(begin, end, worker) over ranges covering
+     *              [0, count) across the pool and wait
+     * Return: void
+     * Pre-condition: grain > 0; body is safe to call concurrently for
+     *                different ranges
+     * Post-condition: Every range has finished; ranges hold at least grain
+     *                 indices (one range runs inline); worker is below
+     *                 getThreadCount() and no two ranges running at once
+     *                 share it, so it can index WorkerSlot state. The
+     *                 calling thread helps, so parallel-for and graphs can
+     *                 nest inside jobs
+     */
+    template <typename Body>
+    void parallelFor(int count, int grain, const Body& body) {
+        runRanges(count, grain, &callRange<Body>, &body);
+    }
+
+    /*
+     * Description: Get threads that run jobs, including the caller
+     * Return: int - thread count (the number of worker slots)
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getThreadCount() const { return threadCount; }
+
+    /*
+     * Description: Set how entity loops use the pool on this machine
+     *              (tools/bench_jobs sweeps both and suggests values)
+     * Return: void
+     * Pre-condition: parallel >= 0, grain > 0
+     * Post-condition: Entity loops of parallel or more entities split into
+     *                 ranges of at least grain; smaller ones run inline
+     */
+    void setTuning(int parallel, int grain) { parallelEntities = parallel; grainEntities = grain; }
+
+    /*
+     * Description: Get the entity-loop tuning (JOB_PARALLEL_ENTITIES and
+     *              JOB_GRAIN_ENTITIES until setTuning)
+     * Return: int - fewest entities worth splitting / fewest per range
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getParallelEntities() const { return parallelEntities; }
+    int getGrainEntities() const { return grainEntities; }
+};
+
+/*
+ * Description: parallelFor on a job system, or one inline range without
+ * Return: void
+ * Pre-condition: As JobSystem::parallelFor; jobs may be null
+ * Post-condition: body has covered [0, count); worker 0 if jobs is null
+ */
+template <typename Body>
+void parallelFor(JobSystem* jobs, int count, int grain, const Body& body) {
+    if(jobs) jobs->parallelFor(count, grain, body);
+    else if(count > 0) body(0, count, 0);
+}
+
+/*
+ * Description: parallelFor over entities, in ranges of the job system's
+ *              grain
+ * Return: void
+ * Pre-condition: As above
+ * Post-condition: As above
+ */
+template <typename Body>
+void parallelFor(JobSystem* jobs, int count, const Body& body) {
+    parallelFor(jobs, count, jobs ? jobs->getGrainEntities() : count, body);
+}
+
+class JobGraph {
+private:
+    struct Node {
+        void     (*run)(void* job);
+        void*    job;
+        uint32_t dependents;     // Bit d set if node d waits on this one
+        int      dependencies;   // Nodes this one waits on
+    };
+
+    Node             nodes[JOB_GRAPH_NODES];
+    std::atomic<int> waiting[JOB_GRAPH_NODES];   // Dependencies left while running
+    std::atomic<int> remaining;                  // Nodes not yet finished
+    int              count;
+    JobSystem*       system;                     // System running the graph
+
+    template <typename Job>
+    static void callJob(void* job) { (*static_cast<Job*>(job))(); }
+    static void runNode(const void* graph, int node, int, int worker);
+
+    friend class JobSystem;
+
+public:
+    /*
+     * Description: Create an empty graph
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: No nodes; no allocation, so a graph can be built on
+     *                 the stack every tick
+     */
+    JobGraph() : count{0}, system{nullptr} {}
+
+    /*
+     * Description: Add a job, called as job() when the graph runs
+     * Return: int - node id, in the order added
+     * Pre-condition: Fewer than JOB_GRAPH_NODES nodes; job outlives run()
+     * Post-condition: Node runs once per run(), after its dependencies
+     */
+    template <typename Job>
+    int add(Job& job) {
+        Node node = { &callJob<Job>, &job, 0, 0 };
+        nodes[count] = node;
+        return count++;
+    }
+
+    /*
+     * Description: Make a job wait for another
+     * Return: void
+     * Pre-condition: 0 <= on < node < node count
+     * Post-condition: node starts only after on has finished
+     */
+    void depend(int node, int on);
+
+    /*
+     * Description: Run every job and wait
+     * Return: void
+     * Pre-condition: Jobs that share state are ordered by depend();
+     *                jobs may be null
+     * Post-condition: Every job has run once; jobs with no path between
+     *                 them may have run at the same time. Without a job
+     *                 system (or with one thread) jobs run in the order added
+     */
+    void run(JobSystem* jobs);
+};
+
+#endif /* JobSystem_h */
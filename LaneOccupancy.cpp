@@ -0,0 +1,103 @@
+//================================================================
+// LaneOccupancy.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Lane Occupancy Implementation
+// Description: Band ranges of predicted motion, reservations, and
+//              mask tests against them
+//================================================================
+
+#include "LaneOccupancy.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+// BAND OF A Y (rounding down above OCCUPANCY_TOP too)
+static int bandOf(int y) {
+    int offset = y - OCCUPANCY_TOP;
+    return offset >= 0 ? offset / OCCUPANCY_BAND_HEIGHT : -((-offset + OCCUPANCY_BAND_HEIGHT - 1) / OCCUPANCY_BAND_HEIGHT);
+}
+
+// BANDS SWEPT IN ONE STEP - the body from where it starts the step to
+// where it ends it, plus reach pixels ahead; false if off the table
+static bool sweptBands(int y, int speed, int step, int halfHeight, int reach, int& first, int& last) {
+    int y0 = y + speed * step * OCCUPANCY_STEP_TICKS;
+    int y1 = y0 + speed * OCCUPANCY_STEP_TICKS;
+    first = std::max(bandOf(std::min(y0, y1) - halfHeight), 0);
+    last = std::min(bandOf(std::max(y0, y1) + halfHeight + reach), OCCUPANCY_BANDS - 1);
+    return first <= last;
+}
+
+static uint64_t bandMask(int first, int last) {
+    int width = last - first + 1;
+    return (width >= 64 ? ~0ULL : (1ULL << width) - 1) << first;
+}
+
+// LOWEST SET BIT - de Bruijn multiply, so no compiler builtins
+static int lowestBit(uint64_t mask) {
+    static const int INDEX[64] = {
+         0,  1,  2, 53,  3,  7, 54, 27,  4, 38, 41,  8, 34, 55, 48, 28,
+        62,  5, 39, 46, 44, 42, 22,  9, 24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52,  6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+    };
+    return INDEX[((mask & (0 - mask)) * 0x022FDD63CC95386DULL) >> 58];
+}
+
+void LaneOccupancy::clear() {
+    std::memset(obstacleRows, 0, sizeof(obstacleRows));
+    std::memset(carRows, 0, sizeof(carRows));
+    std::memset(sharedRows, 0, sizeof(sharedRows));
+}
+
+void LaneOccupancy::addObstacle(int lane, int y, int speed, int halfHeight) {
+    int first, last;
+    for(int step = 0; step < OCCUPANCY_STEPS; step++) {
+        if(sweptBands(y, speed, step, halfHeight, 0, first, last)) obstacleRows[step][lane] |= bandMask(first, last);
+    }
+}
+
+// RESERVATIONS - counted to two, which is enough for a car to tell its
+// own cells from cells someone else holds too
+void LaneOccupancy::reserve(int lane, int y, int speed, int halfHeight) {
+    int first, last;
+    for(int step = 0; step < OCCUPANCY_STEPS; step++) {
+        if(!sweptBands(y, speed, step, halfHeight, 0, first, last)) continue;
+        uint64_t mask = bandMask(first, last);
+        sharedRows[step][lane] |= carRows[step][lane] & mask;
+        carRows[step][lane] |= mask;
+    }
+}
+
+// MERGE - a band either table holds twice, or both hold once, is shared
+void LaneOccupancy::merge(const LaneOccupancy& other) {
+    for(int step = 0; step < OCCUPANCY_STEPS; step++) {
+        for(int lane = 0; lane < 3; lane++) {
+            obstacleRows[step][lane] |= other.obstacleRows[step][lane];
+            sharedRows[step][lane] |= other.sharedRows[step][lane] | (carRows[step][lane] & other.carRows[step][lane]);
+            carRows[step][lane] |= other.carRows[step][lane];
+        }
+    }
+}
+
+bool LaneOccupancy::isClear(int lane, int y, int speed, int halfHeight, int lookahead, bool ownReservation) const {
+    int first, last;
+    for(int step = 0; step < OCCUPANCY_STEPS; step++) {
+        if(!sweptBands(y, speed, step, halfHeight, step == 0 ? lookahead : 0, first, last)) continue;
+        uint64_t others = carRows[step][lane];
+        int ownFirst, ownLast;
+        if(ownReservation && sweptBands(y, speed, step, halfHeight, 0, ownFirst, ownLast)) {
+            others = (others & ~bandMask(ownFirst, ownLast)) | sharedRows[step][lane];
+        }
+        if((obstacleRows[step][lane] | others) & bandMask(first, last)) return false;
+    }
+    return true;
+}
+
+int LaneOccupancy::obstacleGap(int lane, int y) const {
+    int band = bandOf(y);
+    if(band >= OCCUPANCY_BANDS - 1) return INT_MAX;
+    uint64_t ahead = obstacleRows[0][lane];
+    if(band >= 0) ahead &= ~bandMask(0, band);
+    if(ahead == 0) return INT_MAX;
+    return OCCUPANCY_TOP + lowestBit(ahead) * OCCUPANCY_BAND_HEIGHT - y;
+}
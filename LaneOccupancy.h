@@ -0,0 +1,91 @@
+//================================================================
+// LaneOccupancy.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Lane Occupancy
+// Description: Space-time table of the road, by lane, y band and
+//              future step, filled from every entity's predicted
+//              motion so AI cars can plan lane changes and reserve
+//              the cells they will drive through
+//================================================================
+
+#ifndef LaneOccupancy_h
+#define LaneOccupancy_h
+
+#include "Const.h"
+#include <cstdint>
+
+class LaneOccupancy {
+private:
+    // ONE ROW PER STEP AND LANE, ONE BIT PER Y BAND
+    uint64_t obstacleRows[OCCUPANCY_STEPS][3];   // Bands an obstacle sweeps through
+    uint64_t carRows[OCCUPANCY_STEPS][3];        // Bands at least one car has reserved
+    uint64_t sharedRows[OCCUPANCY_STEPS][3];     // Bands two or more cars have reserved
+
+public:
+    /*
+     * Description: Create an empty table
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Every cell free
+     */
+    LaneOccupancy() { clear(); }
+
+    /*
+     * Description: Free every cell
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Every cell free
+     */
+    void clear();
+
+    /*
+     * Description: Mark the cells an obstacle (or the player) will sweep
+     *              through
+     * Return: void
+     * Pre-condition: lane is a valid AILane; speed is pixels per tick down
+     * Post-condition: Its cells in lane are blocked for every step
+     */
+    void addObstacle(int lane, int y, int speed, int halfHeight);
+
+    /*
+     * Description: Claim the cells a car will drive through in a lane at
+     *              its speed
+     * Return: void
+     * Pre-condition: lane is a valid AILane; at most once per car and lane
+     * Post-condition: Other cars' isClear sees the cells taken;
+     *                 O(OCCUPANCY_STEPS) mask updates
+     */
+    void reserve(int lane, int y, int speed, int halfHeight);
+
+    /*
+     * Description: Add another table's obstacles and reservations
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Same table as making other's calls on this one, in
+     *                 any order, so partial tables filled on different
+     *                 threads merge to the single-threaded result
+     */
+    void merge(const LaneOccupancy& other);
+
+    /*
+     * Description: Check a car could drive in a lane for every step
+     *              without meeting an obstacle or another car's cells
+     * Return: bool - true if clear
+     * Pre-condition: lane is a valid AILane; ownReservation true if the
+     *                car reserved this lane with the same arguments
+     * Post-condition: No state change; O(OCCUPANCY_STEPS) mask tests,
+     *                 the first step also looking lookahead pixels ahead
+     */
+    bool isClear(int lane, int y, int speed, int halfHeight, int lookahead, bool ownReservation) const;
+
+    /*
+     * Description: Distance from y to the nearest obstacle band ahead in
+     *              a lane this tick
+     * Return: int - pixels to the start of that band, INT_MAX if none
+     * Pre-condition: lane is a valid AILane
+     * Post-condition: No state change; O(1)
+     */
+    int obstacleGap(int lane, int y) const;
+};
+
+#endif /* LaneOccupancy_h */
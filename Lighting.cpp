@@ -0,0 +1,100 @@
+//================================================================
+// Lighting.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Night Lighting Implementation
+// Description: Light map construction, stamping, and frame apply
+//================================================================
+
+#include "Lighting.h"
+#include <cstring>
+
+// HEADLIGHT CONE AHEAD OF THE CAR PLUS A SOFT GLOW AROUND IT
+static LightMap buildCarLight(int carSize) {
+    LightMap map;
+    int half = carSize / 2;
+    int reach = half + static_cast<int>(HEADLIGHT_LENGTH * HEADLIGHT_SPREAD);
+    if(reach < half + CAR_GLOW_RADIUS) reach = half + CAR_GLOW_RADIUS;
+
+    map.width = 2 * reach + 1;
+    map.height = HEADLIGHT_LENGTH + half + CAR_GLOW_RADIUS + 1 + half;
+    map.originX = -reach;
+    map.originY = -half - HEADLIGHT_LENGTH;
+    map.level.assign(static_cast<size_t>(map.width) * map.height, 0);
+
+    for(int my = 0; my < map.height; my++) {
+        int dy = my + map.originY;  // Relative to car center
+        for(int mx = 0; mx < map.width; mx++) {
+            int dx = mx + map.originX;
+            float light = 0.0f;
+
+            // CONE - widens and fades with distance past the front bumper
+            int ahead = -half - dy;
+            if(ahead >= 0 && ahead < HEADLIGHT_LENGTH) {
+                float spread = half + ahead * HEADLIGHT_SPREAD;
+                float across = std::fabs(static_cast<float>(dx)) / spread;
+                if(across < 1.0f) {
+                    float along = 1.0f - static_cast<float>(ahead) / HEADLIGHT_LENGTH;
+                    light += HEADLIGHT_LEVEL * along * std::sqrt(1.0f - across);
+                }
+            }
+
+            // GLOW - distance from the car's body rectangle
+            int ox = std::abs(dx) - half;
+            int oy = std::abs(dy) - half;
+            float dist = std::sqrt(static_cast<float>(max(ox, 0) * max(ox, 0) + max(oy, 0) * max(oy, 0)));
+            if(dist < CAR_GLOW_RADIUS) {
+                light += CAR_GLOW_LEVEL * (1.0f - dist / CAR_GLOW_RADIUS);
+            }
+
+            map.level[static_cast<size_t>(my) * map.width + mx] =
+                static_cast<Uint8>(light > 255.0f ? 255.0f : light);
+        }
+    }
+    return map;
+}
+
+// NIGHT LIGHTING IMPLEMENTATION
+
+NightLighting::NightLighting()
+    : carLight(buildCarLight(SIZE)),
+      buffer(static_cast<size_t>(ROW) * COL, 0)
+{}
+
+void NightLighting::addCar(const Car& car) {
+    point loc = car.getLoc();
+    int left = loc.x + carLight.originX;
+    int top = loc.y + carLight.originY;
+    int x0 = max(left, 0);
+    int y0 = max(top, 0);
+    int x1 = min(left + carLight.width, ROW);
+    int y1 = min(top + carLight.height, COL);
+    if(x0 >= x1 || y0 >= y1) return;
+
+    // SATURATING ADD (branch-free so the row loop vectorizes)
+    for(int y = y0; y < y1; y++) {
+        Uint8* dst = &buffer[static_cast<size_t>(y) * ROW + x0];
+        const Uint8* src = &carLight.level[static_cast<size_t>(y - top) * carLight.width + (x0 - left)];
+        for(int i = 0; i < x1 - x0; i++) {
+            int sum = dst[i] + src[i];
+            dst[i] = static_cast<Uint8>(sum > 255 ? 255 : sum);
+        }
+    }
+
+    stamped.push_back(x0);
+    stamped.push_back(y0);
+    stamped.push_back(x1);
+    stamped.push_back(y1);
+}
+
+void NightLighting::apply(SDL_Plotter& g) {
+    g.multiplyLight(buffer.data(), NIGHT_AMBIENT);
+
+    // CLEAR ONLY WHAT WAS STAMPED
+    for(size_t i = 0; i < stamped.size(); i += 4) {
+        for(int y = stamped[i + 1]; y < stamped[i + 3]; y++) {
+            std::memset(&buffer[static_cast<size_t>(y) * ROW + stamped[i]], 0,
+                        stamped[i + 2] - stamped[i]);
+        }
+    }
+    stamped.clear();
+}
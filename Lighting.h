@@ -0,0 +1,55 @@
+//================================================================
+// Lighting.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Night Lighting
+// Description: Precomputed headlight and glow light maps stamped
+//              into a per-frame light buffer for night races
+//================================================================
+
+#ifndef Lighting_h
+#define Lighting_h
+
+#include "Const.h"
+#include "Car.h"
+#include <vector>
+
+// LIGHT INTENSITY STAMP (0 = no light, 255 = full)
+struct LightMap {
+    int width, height;            // Map size in pixels
+    int originX, originY;         // Top-left offset from the car center
+    std::vector<Uint8> level;     // Row-major intensities
+};
+
+class NightLighting {
+private:
+    LightMap carLight;            // Headlight cone plus body glow (cars face up)
+    std::vector<Uint8> buffer;    // Light added this frame, ROW x COL
+    std::vector<int> stamped;     // Clipped x0, y0, x1, y1 of each stamp
+
+public:
+    /*
+     * Description: Build the car light map and an unlit light buffer
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Light map computed once, buffer all zero
+     */
+    NightLighting();
+
+    /*
+     * Description: Add a car's headlights and glow to this frame's light
+     * Return: void
+     * Pre-condition: car is valid
+     * Post-condition: Light map saturating-added at the car's location
+     */
+    void addCar(const Car& car);
+
+    /*
+     * Description: Darken the frame by the accumulated light in one pass
+     * Return: void
+     * Pre-condition: World layer drawn into g, cars added this frame
+     * Post-condition: Frame lit, light buffer cleared for the next frame
+     */
+    void apply(SDL_Plotter& g);
+};
+
+#endif /* Lighting_h */
@@ -7,16 +7,28 @@
 
 #include "Obstacle.h"
 #include "Car.h"
+#include "EntityStore.h"
+#include "SpriteMask.h"
+#include <map>
+
+// CONE ROW y COVERS x = -coneHalfWidth .. coneHalfWidth AROUND THE CENTER
+static int coneHalfWidth(int y, int size) {
+    int width = (y * size) / size;
+    return width / 2;
+}
 
-Obstacle::Obstacle(int x, int y, int size)
-    : _loc{point(x, y)},
-      _size{size},
-      _active{true}
+Obstacle::Obstacle(EntityStore& store, int index)
+    : _store{&store},
+      _index{index},
+      _loc{point(store.getObstacleX()[index], store.getObstacleY()[index])},
+      _size{store.getObstacleSize()[index]},
+      _active{store.getObstacleActive()[index] != 0}
 {}
 
 void Obstacle::update(int playerSpeed) {
     if(!_active) return;
 
+    _store->moveObstacle(_index, playerSpeed);
     _loc.y += playerSpeed;
 }
 
@@ -25,8 +37,8 @@ void Obstacle::draw(SDL_Plotter& g) {
 
     // TRAFFIC CONE BASE
     for(int y = 0; y < _size; y++) {
-        int width = (y * _size) / _size;
-        for(int x = -width / 2; x <= width / 2; x++) {
+        int halfWidth = coneHalfWidth(y, _size);
+        for(int x = -halfWidth; x <= halfWidth; x++) {
             int drawX = _loc.x + x;
             int drawY = _loc.y - _size / 2 + y;
 
@@ -60,11 +72,28 @@ bool Obstacle::collidesWith(const Car& car) const {
     int obsTop = _loc.y - _size / 2;
     int obsBottom = _loc.y + _size / 2;
 
-    // COLLISION DETECTION
-    return (carRight > obsLeft &&
-            carLeft < obsRight &&
-            carBottom > obsTop &&
-            carTop < obsBottom);
+    // COLLISION DETECTION - boxes first, then the pixels they cover
+    if(!(carRight > obsLeft &&
+         carLeft < obsRight &&
+         carBottom > obsTop &&
+         carTop < obsBottom)) {
+        return false;
+    }
+    return SpriteMask::overlaps(Car::getMask(carSize), carLeft, carTop, getMask(_size), obsLeft, obsTop);
+}
+
+const SpriteMask& Obstacle::getMask(int size) {
+    static thread_local std::map<int, SpriteMask> masks;
+    std::map<int, SpriteMask>::iterator found = masks.find(size);
+    if(found != masks.end()) return found->second;
+
+    // SAME ROWS AS draw(), RELATIVE TO THE TOP-LEFT CORNER
+    SpriteMask mask(size, size);
+    for(int y = 0; y < size; y++) {
+        int halfWidth = coneHalfWidth(y, size);
+        mask.fillRect(size / 2 - halfWidth, y, 2 * halfWidth + 1, 1);
+    }
+    return masks[size] = mask;
 }
 
 bool Obstacle::isOffScreen() const {
@@ -72,13 +101,12 @@ bool Obstacle::isOffScreen() const {
 }
 
 void Obstacle::respawn() {
-    _loc.x = ROAD_START + OBSTACLE_SPAWN_MIN_X_OFFSET +
-             (rand() % (ROAD_WIDTH - OBSTACLE_SPAWN_MAX_X_OFFSET));
-    _loc.y = -_size - (rand() % OBSTACLE_SPAWN_Y_RANDOM_RANGE);
-    _active = true;
+    _store->respawnObstacle(_index);
+    *this = Obstacle(*_store, _index);
 }
 
 void Obstacle::deactivate() {
+    _store->setObstacleActive(_index, false);
     _active = false;
 }
 
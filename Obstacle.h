@@ -2,7 +2,8 @@
 // Obstacle.h
 // Author: Jody Spikes, Hailey Pieper, Ian Dudley
 // Title: Obstacle Class
-// Description: Traffic cone obstacles with collision detection
+// Description: View of one traffic cone in an entity store, with
+//              drawing and collision detection
 //================================================================
 
 #ifndef Obstacle_h
@@ -11,27 +12,31 @@
 #include "Const.h"
 
 class Car;
+class EntityStore;
+class SpriteMask;
 
 class Obstacle {
 private:
+    EntityStore* _store;	// Store holding the obstacle's fields
+    int _index;		// Obstacle's entry in the store
     point _loc;		// Current position on screen
     int _size;		// Obstacle size in pixels
     bool _active;	// Whether obstacle is active and drawn
 
 public:
     /*
-     * Description: Initialize obstacle at position with size
+     * Description: View one obstacle in an entity store
      * Return: None (constructor)
-     * Pre-condition: x, y within valid bounds
-     * Post-condition: Obstacle created at (x, y) with active state
+     * Pre-condition: index < store.getObstacleCount()
+     * Post-condition: View holds the obstacle's current fields
      */
-    Obstacle(int x, int y, int size = OBSTACLE_SIZE);
+    Obstacle(EntityStore& store, int index);
 
     /*
      * Description: Move obstacle down screen based on player speed
      * Return: void
      * Pre-condition: playerSpeed is valid
-     * Post-condition: Obstacle position updated downward
+     * Post-condition: Store entry and view moved downward
      */
     void update(int playerSpeed);
 
@@ -44,13 +49,23 @@ public:
     void draw(SDL_Plotter& g);
 
     /*
-     * Description: Check collision between obstacle and car
+     * Description: Check collision between obstacle and car: box test,
+     *              then the sprite masks once the boxes overlap
      * Return: bool - true if collision detected, false otherwise
      * Pre-condition: Car object is valid
      * Post-condition: No state change
      */
     bool collidesWith(const Car& car) const;
 
+    /*
+     * Description: Collision mask of a cone, built from the rows draw() fills
+     * Return: const SpriteMask& - size x size mask; its top-left pixel is
+     *         (x - size / 2, y - size / 2) for a cone centered at (x, y)
+     * Pre-condition: size > 0
+     * Post-condition: Mask built on first use of each size in each thread
+     */
+    static const SpriteMask& getMask(int size);
+
     /*
      * Description: Check if obstacle is below visible screen area
      * Return: bool - true if off screen, false otherwise
@@ -63,7 +78,7 @@ public:
      * Description: Reposition obstacle at top with random X position
      * Return: void
      * Pre-condition: None
-     * Post-condition: Obstacle reset to top of screen, active = true
+     * Post-condition: Store entry and view reset to top of screen, active = true
      */
     void respawn();
 
@@ -71,7 +86,7 @@ public:
      * Description: Deactivate obstacle (prevent drawing and collision)
      * Return: void
      * Pre-condition: None
-     * Post-condition: Active state set to false
+     * Post-condition: Store entry and view active state set to false
      */
     void deactivate();
 
@@ -0,0 +1,170 @@
+//================================================================
+// Particles.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Particle Effects Implementation
+// Description: Particle update, compaction, and batched drawing
+//================================================================
+
+#include "Particles.h"
+#include "Random.h"
+#include <cmath>
+
+// RANDOM VALUE IN [0, 1]
+static float randomUnit() {
+    return currentRandom().nextUnit();
+}
+
+// PARTICLE SYSTEM IMPLEMENTATION
+
+ParticleSystem::ParticleSystem(int maxParticles, ParticleBlend mode, int size)
+    : capacity{maxParticles},
+      liveCount{0},
+      quadSize{size},
+      blend{mode},
+      posX(maxParticles), posY(maxParticles),
+      velX(maxParticles), velY(maxParticles),
+      life(maxParticles), fade(maxParticles),
+      tint(maxParticles),
+      batchX(maxParticles), batchY(maxParticles),
+      batchColor(maxParticles)
+{}
+
+void ParticleSystem::emit(float x, float y, float vx, float vy, int lifeFrames, color c) {
+    if(liveCount >= capacity) return;
+
+    int i = liveCount++;
+    posX[i] = x;
+    posY[i] = y;
+    velX[i] = vx;
+    velY[i] = vy;
+    life[i] = static_cast<float>(lifeFrames);
+    fade[i] = 1.0f / lifeFrames;
+    tint[i] = packColor(c);
+}
+
+void ParticleSystem::emitBurst(float x, float y, int count, float speed, int lifeFrames, color c) {
+    for(int n = 0; n < count; n++) {
+        float angle = randomUnit() * 6.2832f;
+        float v = speed * (0.3f + 0.7f * randomUnit());
+        int frames = lifeFrames / 2 + static_cast<int>(randomUnit() * lifeFrames / 2) + 1;
+        emit(x, y, v * std::cos(angle), v * std::sin(angle), frames, c);
+    }
+}
+
+void ParticleSystem::update(float scroll, float drag) {
+    float* px = posX.data();
+    float* py = posY.data();
+    float* vx = velX.data();
+    float* vy = velY.data();
+    float* lf = life.data();
+    const int n = liveCount;
+
+    // INTEGRATE (branch-free so the loop vectorizes)
+    for(int i = 0; i < n; i++) {
+        px[i] += vx[i];
+        py[i] += vy[i] + scroll;
+        vx[i] *= drag;
+        vy[i] *= drag;
+        lf[i] -= 1.0f;
+    }
+
+    // COMPACT - keep live, on-screen particles packed at the front
+    int alive = 0;
+    for(int i = 0; i < n; i++) {
+        if(lf[i] > 0.0f && py[i] < COL) {
+            if(alive != i) {
+                px[alive] = px[i];
+                py[alive] = py[i];
+                vx[alive] = vx[i];
+                vy[alive] = vy[i];
+                lf[alive] = lf[i];
+                fade[alive] = fade[i];
+                tint[alive] = tint[i];
+            }
+            alive++;
+        }
+    }
+    liveCount = alive;
+}
+
+void ParticleSystem::draw(SDL_Plotter& g) {
+    const int n = liveCount;
+    const int half = quadSize / 2;
+
+    for(int i = 0; i < n; i++) {
+        batchX[i] = static_cast<int>(posX[i]) - half;
+        batchY[i] = static_cast<int>(posY[i]) - half;
+    }
+
+    if(blend == BLEND_ADDITIVE) {
+        // FADE OUT - scale channels by remaining life (0..256)
+        for(int i = 0; i < n; i++) {
+            Uint32 a = static_cast<Uint32>(life[i] * fade[i] * 256.0f);
+            Uint32 c = tint[i];
+            batchColor[i] = (((c & 0xFF00FF) * a >> 8) & 0xFF00FF) |
+                            (((c & 0x00FF00) * a >> 8) & 0x00FF00);
+        }
+    } else {
+        for(int i = 0; i < n; i++) {
+            batchColor[i] = tint[i];
+        }
+    }
+
+    g.plotBatch(batchX.data(), batchY.data(), batchColor.data(),
+                n, quadSize, blend == BLEND_ADDITIVE);
+}
+
+// EFFECTS MANAGER IMPLEMENTATION
+
+EffectsManager::EffectsManager()
+    : ground(PARTICLE_CAPACITY, BLEND_OPAQUE, 2),
+      glow(PARTICLE_CAPACITY, BLEND_ADDITIVE, 2)
+{}
+
+void EffectsManager::emitCrash(point contact, color debrisColor) {
+    glow.emitBurst(contact.x, contact.y, CRASH_SPARK_COUNT,
+                   CRASH_SPARK_SPEED, CRASH_SPARK_LIFE, SPARK);
+    ground.emitBurst(contact.x, contact.y, CRASH_DEBRIS_COUNT,
+                     CRASH_DEBRIS_SPEED, CRASH_DEBRIS_LIFE, debrisColor);
+}
+
+void EffectsManager::emitSkid(const Car& car) {
+    point loc = car.getLoc();
+    int half = car.getSize() / 2;
+    int wheel = car.getSize() / 5 + 2;
+
+    // ONE STREAK PER TIRE
+    const int tireX[2] = { loc.x - half + wheel / 2, loc.x + half - wheel / 2 };
+    const int tireY[2] = { loc.y - half + wheel / 2, loc.y + half - wheel / 2 };
+    for(int tx = 0; tx < 2; tx++) {
+        for(int ty = 0; ty < 2; ty++) {
+            for(int n = 0; n < SKID_PARTICLES_PER_TIRE; n++) {
+                ground.emit(tireX[tx] + randomUnit() * 2.0f - 1.0f,
+                            tireY[ty] + n * 2.0f,
+                            0.0f, 0.0f, SKID_LIFE, SKID_MARK);
+            }
+        }
+    }
+}
+
+void EffectsManager::emitExhaust(const Car& car, int count) {
+    point loc = car.getLoc();
+    float rearY = loc.y + car.getSize() / 2.0f;
+
+    for(int n = 0; n < count; n++) {
+        glow.emit(loc.x + randomUnit() * 4.0f - 2.0f, rearY,
+                  (randomUnit() - 0.5f) * EXHAUST_SPEED,
+                  EXHAUST_SPEED * (0.5f + randomUnit()),
+                  EXHAUST_LIFE, EXHAUST);
+    }
+}
+
+void EffectsManager::update(int scrollSpeed) {
+    ground.update(static_cast<float>(scrollSpeed), 0.8f);
+    glow.update(static_cast<float>(scrollSpeed));
+}
+
+void EffectsManager::clear() {
+    ground.clear();
+    glow.clear();
+}
@@ -0,0 +1,169 @@
+//================================================================
+// Particles.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Particle Effects
+// Description: Pooled structure-of-arrays particle system for
+//              crash, skid, and exhaust effects
+//================================================================
+
+#ifndef Particles_h
+#define Particles_h
+
+#include "Const.h"
+#include "Car.h"
+#include <vector>
+
+// BLEND MODES
+enum ParticleBlend {
+    BLEND_OPAQUE,
+    BLEND_ADDITIVE
+};
+
+class ParticleSystem {
+private:
+    int           capacity;     // Maximum live particles (fixed at startup)
+    int           liveCount;    // Particles currently alive, packed at front
+    int           quadSize;     // Side length of each drawn particle in pixels
+    ParticleBlend blend;        // How particles combine with the frame
+
+    // PARTICLE STATE (one entry per particle)
+    std::vector<float>  posX, posY;   // Position in screen space
+    std::vector<float>  velX, velY;   // Velocity in pixels per frame
+    std::vector<float>  life;         // Frames of life remaining
+    std::vector<float>  fade;         // 1 / starting life, for additive fade
+    std::vector<Uint32> tint;         // Packed 0x00RRGGBB color
+
+    // DRAW BATCH (reused every frame)
+    std::vector<int>    batchX, batchY;
+    std::vector<Uint32> batchColor;
+
+public:
+    /*
+     * Description: Preallocate particle pool and draw batch
+     * Return: None (constructor)
+     * Pre-condition: maxParticles > 0, size >= 1
+     * Post-condition: Empty system created, no further allocation needed
+     */
+    ParticleSystem(int maxParticles, ParticleBlend mode, int size);
+
+    /*
+     * Description: Spawn one particle (dropped if pool is full)
+     * Return: void
+     * Pre-condition: lifeFrames > 0
+     * Post-condition: Particle appended to live range
+     */
+    void emit(float x, float y, float vx, float vy, int lifeFrames, color c);
+
+    /*
+     * Description: Spawn particles in random directions from one point
+     * Return: void
+     * Pre-condition: count >= 0, speed >= 0
+     * Post-condition: Up to count particles appended to live range
+     */
+    void emitBurst(float x, float y, int count, float speed, int lifeFrames, color c);
+
+    /*
+     * Description: Advance all particles one frame and remove dead ones
+     * Return: void
+     * Pre-condition: scroll is the road scroll speed this frame
+     * Post-condition: Particles moved, aged, and live range compacted
+     */
+    void update(float scroll, float drag = PARTICLE_DRAG);
+
+    /*
+     * Description: Draw all live particles in one batched plot
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Particles rendered with the system's blend mode
+     */
+    void draw(SDL_Plotter& g);
+
+    /*
+     * Description: Kill all live particles
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: liveCount = 0
+     */
+    void clear() { liveCount = 0; }
+
+    /*
+     * Description: Get number of live particles
+     * Return: int - live particle count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getLiveCount() const { return liveCount; }
+};
+
+class EffectsManager {
+private:
+    ParticleSystem ground;   // Opaque skid marks and debris, drawn under cars
+    ParticleSystem glow;     // Additive sparks and exhaust, drawn over cars
+
+public:
+    /*
+     * Description: Allocate both particle pools
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Effects ready with no live particles
+     */
+    EffectsManager();
+
+    /*
+     * Description: Emit sparks and debris at a collision point
+     * Return: void
+     * Pre-condition: contact is the collision point
+     * Post-condition: Crash particles added to both pools
+     */
+    void emitCrash(point contact, color debrisColor);
+
+    /*
+     * Description: Emit skid marks from all four tires of a car
+     * Return: void
+     * Pre-condition: car is valid
+     * Post-condition: Skid particles added to ground pool
+     */
+    void emitSkid(const Car& car);
+
+    /*
+     * Description: Emit exhaust puffs behind a car
+     * Return: void
+     * Pre-condition: car is valid, count >= 0
+     * Post-condition: Exhaust particles added to glow pool
+     */
+    void emitExhaust(const Car& car, int count);
+
+    /*
+     * Description: Advance all effects one frame
+     * Return: void
+     * Pre-condition: scrollSpeed is the player speed (0 when frozen)
+     * Post-condition: Both pools updated and compacted
+     */
+    void update(int scrollSpeed);
+
+    /*
+     * Description: Draw effects that sit on the road surface
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Skid marks and debris rendered
+     */
+    void drawGround(SDL_Plotter& g) { ground.draw(g); }
+
+    /*
+     * Description: Draw effects that sit above the cars
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Sparks and exhaust blended onto frame
+     */
+    void drawGlow(SDL_Plotter& g) { glow.draw(g); }
+
+    /*
+     * Description: Remove every live effect
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Both pools empty
+     */
+    void clear();
+};
+
+#endif /* Particles_h */
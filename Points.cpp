@@ -6,6 +6,7 @@
 //================================================================
 
 #include "Points.h"
+#include "StateStream.h"
 
 PointsManager::PointsManager()
     : score{0},
@@ -33,9 +34,9 @@ void PointsManager::updateSpeed(int playerSpeed) {
 
 void PointsManager::update() {
     frameCounter++;
-    float basePointsPerFrame = POINTS_PER_FRAME_BASE +
-                               (speedMultiplier * POINTS_PER_FRAME_MULTIPLIER);
-    int timePoints = static_cast<int>(basePointsPerFrame);
+    int basePointsPerFrame = POINTS_PER_FRAME_BASE * POINTS_FIXED_ONE +
+                             (speedMultiplier * POINTS_PER_FRAME_MULTIPLIER) / POINTS_FIXED_ONE;
+    int timePoints = basePointsPerFrame / POINTS_FIXED_ONE;
 
     if(timePoints > 0) {
         score += timePoints;
@@ -43,13 +44,31 @@ void PointsManager::update() {
 }
 
 void PointsManager::addCarPass() {
-    int points = static_cast<int>(POINTS_CAR_PASS * speedMultiplier);
+    int points = POINTS_CAR_PASS * speedMultiplier / POINTS_FIXED_ONE;
     score += points;
     carsPassed++;
 }
 
 void PointsManager::addObstacleAvoided() {
-    int points = static_cast<int>(POINTS_OBSTACLE_AVOIDED * speedMultiplier);
+    int points = POINTS_OBSTACLE_AVOIDED * speedMultiplier / POINTS_FIXED_ONE;
     score += points;
     obstaclesAvoided++;
 }
+
+void PointsManager::saveState(StateWriter& out) const {
+    out.put(score);
+    out.put(baseSpeed);
+    out.put(speedMultiplier);
+    out.put(carsPassed);
+    out.put(obstaclesAvoided);
+    out.put(frameCounter);
+}
+
+void PointsManager::loadState(StateReader& in) {
+    in.get(score);
+    in.get(baseSpeed);
+    in.get(speedMultiplier);
+    in.get(carsPassed);
+    in.get(obstaclesAvoided);
+    in.get(frameCounter);
+}
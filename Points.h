@@ -10,11 +10,14 @@
 
 #include "Const.h"
 
+class StateWriter;  // Forward declaration
+class StateReader;  // Forward declaration
+
 class PointsManager {
 private:
     int 	score;              // Total player score
     int 	baseSpeed;          // Current player speed
-    float 	speedMultiplier;  	// Speed-based score multiplier
+    int 	speedMultiplier;  	// Speed-based score multiplier (POINTS_FIXED_ONE = 1.0)
     int 	carsPassed;         // Number of AI cars passed
     int 	obstaclesAvoided;   // Number of obstacles avoided
     int 	frameCounter;       // Frame counter for score calculation
@@ -94,11 +97,21 @@ public:
 
     /*
      * Description: Get current speed multiplier
-     * Return: float - current multiplier value
+     * Return: float - current multiplier value (display only; scoring
+     *         uses the fixed-point value)
      * Pre-condition: None
      * Post-condition: No state change
      */
-    float getSpeedMultiplier() const { return speedMultiplier; }
+    float getSpeedMultiplier() const { return speedMultiplier / static_cast<float>(POINTS_FIXED_ONE); }
+
+    /*
+     * Description: Save or restore every score field
+     * Return: void
+     * Pre-condition: in holds what saveState wrote
+     * Post-condition: Fields written to out, or read back from in
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
 };
 
 #endif /* Points_h */
@@ -0,0 +1,173 @@
+//================================================================
+// PostProcess.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Post-Processing Pipeline Implementation
+// Description: Pass kernels, row-band scheduling, and budget checks
+//================================================================
+
+#include "PostProcess.h"
+#include <chrono>
+
+// SCALE ALL CHANNELS BY s / 256 (s in 0..256)
+static inline Uint32 scaleColor(Uint32 c, Uint32 s) {
+    return (((c & 0xFF00FF) * s >> 8) & 0xFF00FF) |
+           (((c & 0x00FF00) * s >> 8) & 0x00FF00);
+}
+
+// SCANLINES
+void ScanlinePass::run(const Uint32* src, Uint32* dst, int width, int y0, int y1) {
+    for(int y = y0; y < y1; y++) {
+        const Uint32* in = src + y * width;
+        Uint32* out = dst + y * width;
+        Uint32 s = (y & 1) ? SCANLINE_LEVEL : 256;
+        for(int x = 0; x < width; x++) out[x] = scaleColor(in[x], s);
+    }
+}
+
+// VIGNETTE
+static void buildFalloff(std::vector<Uint32>& scale, int length) {
+    scale.resize(length);
+    for(int i = 0; i < length; i++) {
+        float d = (2.0f * i + 1.0f) / length - 1.0f;  // -1 .. 1 across the screen
+        float s = 1.0f - VIGNETTE_STRENGTH * d * d;
+        scale[i] = static_cast<Uint32>(s * 256.0f);
+    }
+}
+
+void VignettePass::resize(int width, int height) {
+    buildFalloff(columnScale, width);
+    buildFalloff(rowScale, height);
+}
+
+void VignettePass::run(const Uint32* src, Uint32* dst, int width, int y0, int y1) {
+    const Uint32* cs = columnScale.data();
+    for(int y = y0; y < y1; y++) {
+        const Uint32* in = src + y * width;
+        Uint32* out = dst + y * width;
+        Uint32 rs = rowScale[y];
+        for(int x = 0; x < width; x++) out[x] = scaleColor(in[x], cs[x] * rs >> 8);
+    }
+}
+
+// MOTION STREAK
+void MotionStreakPass::resize(int width, int height) {
+    history.assign(static_cast<size_t>(width) * height, 0);
+    primed = false;
+}
+
+void MotionStreakPass::setSpeed(int speed) {
+    int over = speed - MIN_SPEED;
+    if(over < 0) over = 0;
+    weight = static_cast<Uint32>(STREAK_MAX_WEIGHT * over / (MAX_SPEED - MIN_SPEED));
+}
+
+void MotionStreakPass::run(const Uint32* src, Uint32* dst, int width, int y0, int y1) {
+    Uint32 w = primed ? weight : 0;
+    Uint32 keep = 256 - w;
+    for(int y = y0; y < y1; y++) {
+        const Uint32* in = src + y * width;
+        Uint32* out = dst + y * width;
+        Uint32* past = history.data() + y * width;
+        for(int x = 0; x < width; x++) {
+            Uint32 a = in[x];
+            Uint32 b = past[x];
+            Uint32 c = ((((a & 0xFF00FF) * keep + (b & 0xFF00FF) * w) >> 8) & 0xFF00FF) |
+                       ((((a & 0x00FF00) * keep + (b & 0x00FF00) * w) >> 8) & 0x00FF00);
+            out[x] = c;
+            past[x] = c;
+        }
+    }
+}
+
+// PIPELINE IMPLEMENTATION
+
+PostPipeline::PostPipeline(ThreadPool& threads)
+    : pool(threads),
+      streak{nullptr},
+      width{0},
+      height{0},
+      overBudgetFrames{0},
+      underBudgetFrames{0},
+      budgetEvents{0},
+      lastBudgetPass{nullptr},
+      lastBudgetMs{0.0}
+{
+    streak = new MotionStreakPass();
+    passes.push_back(std::unique_ptr<PostPass>(streak));
+    passes.push_back(std::unique_ptr<PostPass>(new ScanlinePass()));
+    passes.push_back(std::unique_ptr<PostPass>(new VignettePass()));
+}
+
+bool PostPipeline::process(const Uint32* src, Uint32* dst, int w, int h) {
+    if(w != width || h != height) {
+        width = w;
+        height = h;
+        for(auto& p : passes) p->resize(w, h);
+    }
+
+    const int bands = pool.getThreadCount() * 2;
+    const int bandRows = (h + bands - 1) / bands;
+    const Uint32* in = src;
+    bool wrote = false;
+    double total = 0.0;
+
+    for(auto& p : passes) {
+        if(!p->isEnabled()) continue;
+
+        PostPass* pass = p.get();
+        auto start = std::chrono::steady_clock::now();
+        pool.run(bands, [&](int band) {
+            int y0 = band * bandRows;
+            int y1 = y0 + bandRows < h ? y0 + bandRows : h;
+            if(y0 < y1) pass->run(in, dst, w, y0, y1);
+        });
+        auto end = std::chrono::steady_clock::now();
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        pass->recordTime(ms);
+        total += ms;
+        in = dst;  // Later passes filter in place
+        wrote = true;
+    }
+    streak->setPrimed(streak->isEnabled());
+
+    // OVER BUDGET - drop the last (lowest priority) enabled pass
+    if(total > POST_FRAME_BUDGET_MS) {
+        underBudgetFrames = 0;
+        if(++overBudgetFrames >= POST_OVER_BUDGET_FRAMES) {
+            for(int i = getPassCount() - 1; i >= 0; i--) {
+                if(passes[i]->isEnabled()) {
+                    passes[i]->disableForBudget();
+                    lastBudgetPass = passes[i].get();
+                    lastBudgetMs = total;
+                    budgetEvents++;
+                    break;
+                }
+            }
+            overBudgetFrames = 0;
+        }
+        return wrote;
+    }
+    overBudgetFrames = 0;
+
+    // WELL UNDER BUDGET - bring back the first (highest priority) pass the
+    // budget dropped; the gap between the two thresholds keeps a frame
+    // time near the budget from toggling passes back and forth
+    if(total < POST_FRAME_BUDGET_MS / 2) {
+        if(++underBudgetFrames >= POST_UNDER_BUDGET_FRAMES) {
+            for(auto& p : passes) {
+                if(p->wasAutoDisabled()) {
+                    p->restoreForBudget();
+                    lastBudgetPass = p.get();
+                    lastBudgetMs = total;
+                    budgetEvents++;
+                    break;
+                }
+            }
+            underBudgetFrames = 0;
+        }
+    } else {
+        underBudgetFrames = 0;
+    }
+    return wrote;
+}
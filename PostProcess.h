@@ -0,0 +1,199 @@
+//================================================================
+// PostProcess.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Post-Processing Pipeline
+// Description: Ordered full-screen passes (CRT scanlines, vignette,
+//              motion streak) run in parallel row bands with
+//              per-pass timers and a frame budget
+//================================================================
+
+#ifndef PostProcess_h
+#define PostProcess_h
+
+#include "Const.h"
+#include "ThreadPool.h"
+#include <memory>
+#include <vector>
+
+// ONE FULL-SCREEN PASS
+class PostPass {
+protected:
+    bool   enabled;       // Runs this frame
+    bool   autoDisabled;  // Turned off by the frame budget
+    double averageMs;     // Smoothed time per frame
+
+public:
+    /*
+     * Description: Create an enabled pass with no timing history
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: enabled = true, averageMs = 0
+     */
+    PostPass() : enabled{true}, autoDisabled{false}, averageMs{0.0} {}
+
+    /*
+     * Description: Get the pass name for reports
+     * Return: const char* - name
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    virtual const char* getName() const = 0;
+
+    /*
+     * Description: Build size-dependent tables
+     * Return: void
+     * Pre-condition: width, height > 0
+     * Post-condition: Pass ready for frames of this size
+     */
+    virtual void resize(int, int) {}
+
+    /*
+     * Description: Filter rows y0 .. y1 - 1 of a row-major frame
+     * Return: void
+     * Pre-condition: src and dst hold width * height pixels, src may equal dst
+     * Post-condition: Rows written to dst; other rows untouched
+     */
+    virtual void run(const Uint32* src, Uint32* dst, int width, int y0, int y1) = 0;
+
+    /*
+     * Description: Enable or disable the pass
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: enabled updated, budget flag cleared
+     */
+    void setEnabled(bool flag) { enabled = flag; autoDisabled = false; }
+    bool isEnabled() const { return enabled; }
+    bool wasAutoDisabled() const { return autoDisabled; }
+
+    /*
+     * Description: Record one frame's time, or disable / restore for the budget
+     * Return: void
+     * Pre-condition: ms >= 0
+     * Post-condition: averageMs smoothed / pass disabled / pass re-enabled
+     */
+    void recordTime(double ms) { averageMs = averageMs * 0.9 + ms * 0.1; }
+    void disableForBudget() { enabled = false; autoDisabled = true; }
+    void restoreForBudget() { enabled = true; autoDisabled = false; }
+    double getAverageMs() const { return averageMs; }
+
+    /*
+     * Description: Virtual destructor
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: Derived resources released
+     */
+    virtual ~PostPass() {}
+};
+
+// CRT SCANLINES - darken every other row
+class ScanlinePass : public PostPass {
+public:
+    const char* getName() const override { return "scanlines"; }
+    void run(const Uint32* src, Uint32* dst, int width, int y0, int y1) override;
+};
+
+// VIGNETTE - separable falloff toward the screen edges
+class VignettePass : public PostPass {
+private:
+    std::vector<Uint32> columnScale;  // 0..256 per column
+    std::vector<Uint32> rowScale;     // 0..256 per row
+
+public:
+    const char* getName() const override { return "vignette"; }
+    void resize(int width, int height) override;
+    void run(const Uint32* src, Uint32* dst, int width, int y0, int y1) override;
+};
+
+// MOTION STREAK - blend with the previous output, stronger at speed
+class MotionStreakPass : public PostPass {
+private:
+    std::vector<Uint32> history;  // Last output frame
+    Uint32 weight;                // History weight 0..256 this frame
+    bool   primed;                // history holds a real frame
+
+public:
+    MotionStreakPass() : weight{0}, primed{false} {}
+    const char* getName() const override { return "motion streak"; }
+    void resize(int width, int height) override;
+    void run(const Uint32* src, Uint32* dst, int width, int y0, int y1) override;
+
+    /*
+     * Description: Set streak strength from the player speed
+     * Return: void
+     * Pre-condition: speed >= 0 (0 outside of racing)
+     * Post-condition: weight updated for the next frame
+     */
+    void setSpeed(int speed);
+
+    /*
+     * Description: Mark whether history holds the last output frame
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: primed updated
+     */
+    void setPrimed(bool flag) { primed = flag; }
+};
+
+class PostPipeline : public FrameFilter {
+private:
+    ThreadPool& pool;
+    std::vector<std::unique_ptr<PostPass>> passes;  // Run in order
+    MotionStreakPass* streak;                       // Owned by passes
+    int width, height;
+    int overBudgetFrames;                           // Consecutive frames over budget
+    int underBudgetFrames;                          // Consecutive frames under half the budget
+    int budgetEvents;                               // Passes disabled or restored so far
+    PostPass* lastBudgetPass;                       // Pass of the latest budget event
+    double lastBudgetMs;                            // Frame time that triggered it
+
+public:
+    /*
+     * Description: Build the scanline, vignette, and motion streak passes
+     * Return: None (constructor)
+     * Pre-condition: pool outlives the pipeline
+     * Post-condition: All passes enabled
+     */
+    explicit PostPipeline(ThreadPool& threads);
+
+    /*
+     * Description: Run enabled passes over the finished frame
+     * Return: bool - true if dst holds the filtered frame
+     * Pre-condition: src is row-major width x height
+     * Post-condition: Passes timed; lowest-priority pass disabled after
+     *                 POST_OVER_BUDGET_FRAMES frames over POST_FRAME_BUDGET_MS,
+     *                 highest-priority budget-disabled pass restored after
+     *                 POST_UNDER_BUDGET_FRAMES frames under half of it
+     */
+    bool process(const Uint32* src, Uint32* dst, int w, int h) override;
+
+    /*
+     * Description: Feed the player speed to the motion streak
+     * Return: void
+     * Pre-condition: speed >= 0
+     * Post-condition: Streak strength updated
+     */
+    void setSpeed(int speed) { streak->setSpeed(speed); }
+
+    /*
+     * Description: Access passes for toggles and timing reports
+     * Return: PostPass& / int
+     * Pre-condition: 0 <= index < getPassCount()
+     * Post-condition: No state change
+     */
+    int getPassCount() const { return static_cast<int>(passes.size()); }
+    PostPass& getPass(int index) { return *passes[index]; }
+
+    /*
+     * Description: Get passes the budget has disabled or restored, and the
+     *              latest one (wasAutoDisabled tells which way)
+     * Return: int - event count / const PostPass* - nullptr before the
+     *         first event / double - frame ms that triggered it
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getBudgetEvents() const { return budgetEvents; }
+    const PostPass* getLastBudgetPass() const { return lastBudgetPass; }
+    double getLastBudgetMs() const { return lastBudgetMs; }
+};
+
+#endif /* PostProcess_h */
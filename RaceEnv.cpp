@@ -0,0 +1,184 @@
+//================================================================
+// RaceEnv.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Vectorized Training Environment Implementation
+// Description: Lockstep batch stepping, auto-reset, and entity-vector
+//              and semantic-frame observations
+//================================================================
+
+#include "RaceEnv.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+const int FRAME_CELLS = ENV_FRAME_WIDTH * ENV_FRAME_HEIGHT;
+
+RaceEnv::RaceEnv(int count, ObservationMode observationMode, int threads,
+                 int episodeTicks, const RaceParams& raceParams)
+    : envCount{count},
+      mode{observationMode},
+      maxTicks{episodeTicks},
+      params(raceParams),
+      sims(count),
+      nextSeed(count, 0),
+      lastScore(count, 0),
+      rewards(count, 0.0f),
+      dones(count, 0),
+      emptyFrame(FRAME_CELLS, CELL_GRASS),
+      pool(threads),
+      pendingActions{nullptr}
+{
+    if(mode == OBSERVE_ENTITIES) observations.assign(static_cast<size_t>(count) * ENV_OBSERVATION_SIZE, 0.0f);
+    else frames.assign(static_cast<size_t>(count) * FRAME_CELLS, CELL_GRASS);
+
+    // ROAD CELLS - a cell is road if its center column is
+    for(int cx = 0; cx < ENV_FRAME_WIDTH; cx++) {
+        int x = cx * ENV_FRAME_SCALE + ENV_FRAME_SCALE / 2;
+        if(x < ROAD_START || x >= ROAD_END) continue;
+        for(int cy = 0; cy < ENV_FRAME_HEIGHT; cy++) emptyFrame[cy * ENV_FRAME_WIDTH + cx] = CELL_ROAD;
+    }
+
+    tasks = std::min(envCount, pool.getThreadCount() * ENV_TASKS_PER_THREAD);
+    stepTask = [this](int task) { stepBatch(task); };
+}
+
+void RaceEnv::reset(uint64_t seed) {
+    for(int i = 0; i < envCount; i++) {
+        nextSeed[i] = seed + i;
+        startEpisode(i);
+        observe(i);
+        rewards[i] = 0.0f;
+        dones[i] = 0;
+    }
+}
+
+void RaceEnv::step(const Uint8* actions) {
+    pendingActions = actions;
+    pool.run(tasks, stepTask);
+    pendingActions = nullptr;
+}
+
+void RaceEnv::startEpisode(int i) {
+    sims[i].reset(nextSeed[i], false, params);
+    nextSeed[i] += envCount;
+    lastScore[i] = 0;
+}
+
+void RaceEnv::stepBatch(int task) {
+    const int begin = static_cast<int>(static_cast<long long>(task) * envCount / tasks);
+    const int end = static_cast<int>(static_cast<long long>(task + 1) * envCount / tasks);
+
+    for(int i = begin; i < end; i++) {
+        Simulation& sim = sims[i];
+        TickEvents events = sim.step(makeTickInput(static_cast<char>(pendingActions[i]), false));
+
+        // REWARD - score gained, or the game over score's loss on a crash
+        int score = events.crashed ? events.crashScore : sim.getScore();
+        rewards[i] = static_cast<float>(score - lastScore[i]);
+        lastScore[i] = score;
+
+        bool done = events.crashed || events.over || events.won || sim.getTick() >= maxTicks;
+        dones[i] = done;
+        if(done) startEpisode(i);
+        observe(i);
+    }
+}
+
+// OBSERVATIONS
+void RaceEnv::observe(int i) {
+    if(mode == OBSERVE_ENTITIES) observeEntities(i);
+    else observeFrame(i);
+}
+
+// Up to k indices of the active entities nearest p vertically, nearest first
+static int nearestEntities(const int* ys, const Uint8* active, int count, int py, int* picked, int k) {
+    int distance[ENV_OBSERVED_CARS + ENV_OBSERVED_OBSTACLES];
+    int found = 0;
+    for(int j = 0; j < count; j++) {
+        if(active && !active[j]) continue;
+        int d = std::abs(ys[j] - py);
+        if(found == k && d >= distance[k - 1]) continue;
+
+        int slot = found < k ? found++ : k - 1;
+        while(slot > 0 && distance[slot - 1] > d) {
+            distance[slot] = distance[slot - 1];
+            picked[slot] = picked[slot - 1];
+            slot--;
+        }
+        distance[slot] = d;
+        picked[slot] = j;
+    }
+    return found;
+}
+
+void RaceEnv::observeEntities(int i) {
+    const Simulation& sim = sims[i];
+    const EntityStore& e = sim.getEntities();
+    point p = sim.getPlayer().getLoc();
+    float* out = &observations[static_cast<size_t>(i) * ENV_OBSERVATION_SIZE];
+
+    // PLAYER
+    *out++ = static_cast<float>(p.x - ROAD_START) / ROAD_WIDTH;
+    *out++ = static_cast<float>(sim.getPlayer().getSpeed()) / MAX_SPEED;
+    *out++ = static_cast<float>(sim.getLap()) / MAX_LAPS;
+
+    // NEAREST AI CARS - present, offset from the player, speed
+    int picked[ENV_OBSERVED_CARS + ENV_OBSERVED_OBSTACLES];
+    int found = nearestEntities(e.getAIY(), nullptr, e.getAICount(), p.y, picked, ENV_OBSERVED_CARS);
+    for(int k = 0; k < ENV_OBSERVED_CARS; k++, out += ENV_ENTITY_FEATURES) {
+        if(k >= found) {
+            out[0] = out[1] = out[2] = out[3] = 0.0f;
+            continue;
+        }
+        int j = picked[k];
+        out[0] = 1.0f;
+        out[1] = static_cast<float>(e.getAIX()[j] - p.x) / ROAD_WIDTH;
+        out[2] = static_cast<float>(e.getAIY()[j] - p.y) / COL;
+        out[3] = static_cast<float>(e.getAISpeed()[j]) / MAX_SPEED;
+    }
+
+    // NEAREST OBSTACLES - present, offset from the player, size
+    found = nearestEntities(e.getObstacleY(), e.getObstacleActive(), e.getObstacleCount(), p.y,
+                            picked, ENV_OBSERVED_OBSTACLES);
+    for(int k = 0; k < ENV_OBSERVED_OBSTACLES; k++, out += ENV_ENTITY_FEATURES) {
+        if(k >= found) {
+            out[0] = out[1] = out[2] = out[3] = 0.0f;
+            continue;
+        }
+        int j = picked[k];
+        out[0] = 1.0f;
+        out[1] = static_cast<float>(e.getObstacleX()[j] - p.x) / ROAD_WIDTH;
+        out[2] = static_cast<float>(e.getObstacleY()[j] - p.y) / COL;
+        out[3] = static_cast<float>(e.getObstacleSize()[j]) / OBSTACLE_SIZE;
+    }
+}
+
+// Mark every cell a centered square touches, clipped to the screen
+static void fillCells(Uint8* frame, int cx, int cy, int size, Uint8 cell) {
+    int x0 = std::max(cx - size / 2, 0), x1 = std::min(cx + size / 2, ROW) - 1;
+    int y0 = std::max(cy - size / 2, 0), y1 = std::min(cy + size / 2, COL) - 1;
+    if(x0 > x1 || y0 > y1) return;
+
+    x0 /= ENV_FRAME_SCALE;  x1 /= ENV_FRAME_SCALE;
+    y0 /= ENV_FRAME_SCALE;  y1 /= ENV_FRAME_SCALE;
+    for(int y = y0; y <= y1; y++) {
+        std::memset(frame + y * ENV_FRAME_WIDTH + x0, cell, x1 - x0 + 1);
+    }
+}
+
+void RaceEnv::observeFrame(int i) {
+    const Simulation& sim = sims[i];
+    const EntityStore& e = sim.getEntities();
+    Uint8* frame = &frames[static_cast<size_t>(i) * FRAME_CELLS];
+    std::memcpy(frame, emptyFrame.data(), FRAME_CELLS);
+
+    // DRAW ORDER MATCHES THE GAME - obstacles, AI cars, then the player
+    for(int j = 0; j < e.getObstacleCount(); j++) {
+        if(e.getObstacleActive()[j]) {
+            fillCells(frame, e.getObstacleX()[j], e.getObstacleY()[j], e.getObstacleSize()[j], CELL_OBSTACLE);
+        }
+    }
+    for(int j = 0; j < e.getAICount(); j++) fillCells(frame, e.getAIX()[j], e.getAIY()[j], SIZE, CELL_AI_CAR);
+    point p = sim.getPlayer().getLoc();
+    fillCells(frame, p.x, p.y, SIZE, CELL_PLAYER);
+}
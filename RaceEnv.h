@@ -0,0 +1,128 @@
+//================================================================
+// RaceEnv.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Vectorized Training Environment
+// Description: Many independent races stepped in lockstep on a thread
+//              pool for training driving agents; observations, rewards
+//              and done flags live in preallocated contiguous buffers
+//================================================================
+
+#ifndef RaceEnv_h
+#define RaceEnv_h
+
+#include "Simulation.h"
+#include "ThreadPool.h"
+#include <functional>
+#include <vector>
+
+class RaceEnv {
+private:
+    int                     envCount;
+    ObservationMode         mode;
+    int                     maxTicks;         // Episode cut-off
+    RaceParams              params;           // Settings every episode starts with
+    std::vector<Simulation> sims;
+    std::vector<uint64_t>   nextSeed;         // Seed of each environment's next episode
+    std::vector<int>        lastScore;        // Score after the previous step
+    std::vector<float>      observations;     // envCount x ENV_OBSERVATION_SIZE (entity mode)
+    std::vector<Uint8>      frames;           // envCount x ENV_FRAME_WIDTH x ENV_FRAME_HEIGHT (frame mode)
+    std::vector<float>      rewards;
+    std::vector<Uint8>      dones;
+    std::vector<Uint8>      emptyFrame;       // Grass and road, copied under each frame
+    ThreadPool              pool;
+    int                     tasks;            // Batches per step
+    const Uint8*            pendingActions;   // Actions for the step in progress
+    std::function<void(int)> stepTask;        // Built once so stepping never allocates
+
+    /*
+     * Description: Step one batch of environments
+     * Return: void
+     * Pre-condition: pendingActions set
+     * Post-condition: Environments [task * envCount / tasks, (task + 1) * envCount / tasks) stepped
+     */
+    void stepBatch(int task);
+
+    /*
+     * Description: Start environment i's next episode
+     * Return: void
+     * Pre-condition: 0 <= i < envCount
+     * Post-condition: Race reset from nextSeed[i], which moves on by envCount
+     */
+    void startEpisode(int i);
+
+    /*
+     * Description: Write environment i's observation
+     * Return: void
+     * Pre-condition: 0 <= i < envCount
+     * Post-condition: Entity vector or semantic frame for i filled in
+     */
+    void observe(int i);
+    void observeEntities(int i);
+    void observeFrame(int i);
+
+public:
+    /*
+     * Description: Create the environments and their buffers
+     * Return: None (constructor)
+     * Pre-condition: count > 0; threads >= 0 (0 = one per hardware thread)
+     * Post-condition: All buffers sized; call reset before step
+     */
+    RaceEnv(int count, ObservationMode observationMode, int threads = 0,
+            int episodeTicks = ENV_MAX_TICKS, const RaceParams& raceParams = RaceParams());
+
+    /*
+     * Description: Start a fresh episode in every environment
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Environment i races seed + i; later episodes use
+     *                 seed + i + envCount, seed + i + 2 * envCount, ...;
+     *                 observations filled, rewards and dones cleared
+     */
+    void reset(uint64_t seed);
+
+    /*
+     * Description: Advance every environment one tick
+     * Return: void
+     * Pre-condition: actions holds envCount arrow codes (0 = none)
+     * Post-condition: Rewards are score gained this tick (the crash
+     *                 penalty on a crash); an environment whose episode
+     *                 crashed, was won or hit the tick cap is done, and
+     *                 has already started its next episode, so its
+     *                 observation is that episode's first; nothing is
+     *                 allocated
+     */
+    void step(const Uint8* actions);
+
+    /*
+     * Description: Get the output buffers, one entry (or row) per environment
+     * Return: Pointer to contiguous data valid until the next reset or step
+     * Pre-condition: getObservations in OBSERVE_ENTITIES mode, getFrames in OBSERVE_FRAME mode
+     * Post-condition: No state change
+     */
+    const float* getObservations() const { return observations.data(); }
+    const Uint8* getFrames() const { return frames.data(); }
+    const float* getRewards() const { return rewards.data(); }
+    const Uint8* getDones() const { return dones.data(); }
+
+    /*
+     * Description: Get environment sizes
+     * Return: int - environment count, or floats / bytes per observation
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getEnvCount() const { return envCount; }
+    int getObservationSize() const {
+        return mode == OBSERVE_ENTITIES ? ENV_OBSERVATION_SIZE : ENV_FRAME_WIDTH * ENV_FRAME_HEIGHT;
+    }
+    int getThreadCount() const { return pool.getThreadCount(); }
+
+    /*
+     * Description: Get one environment's race
+     * Return: const Simulation& - the race in progress
+     * Pre-condition: 0 <= i < envCount
+     * Post-condition: No state change
+     */
+    const Simulation& getSimulation(int i) const { return sims[i]; }
+};
+
+#endif /* RaceEnv_h */
@@ -0,0 +1,74 @@
+//================================================================
+// RaceParams.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Race Parameters
+// Description: Tunable AI and spawn settings for one race, defaulting
+//              to the values in Const.h, so tools can sweep them
+//================================================================
+
+#ifndef RaceParams_h
+#define RaceParams_h
+
+#include "Const.h"
+#include <algorithm>
+
+struct RaceParams {
+    int laneChangeThreshold;   // Chance in 100 an AI car tries a lane change per decision
+    int laneChangeDelay;       // Ticks between AI lane decisions
+    int laneLookahead;         // Pixels ahead an obstacle blocks a lane
+    int aiSpawnRange;          // Random extra height above the screen for AI respawns
+    int obstacleSpawnRange;    // Random extra height above the screen for obstacle respawns
+    int aiSpeedBonus;          // Added to every AI car's starting speed
+    int trafficPerLap;         // AI cars and obstacles added at each new lap (up to the pools)
+    int startTraffic;          // AI cars and obstacles added at the start on top of the first three
+    int aiDecisionBudget;      // Most AI lane decisions run in one tick
+
+    /*
+     * Description: Parameters the game ships with
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Every field set from Const.h
+     */
+    RaceParams()
+        : laneChangeThreshold{AI_LANE_CHANGE_THRESHOLD},
+          laneChangeDelay{AI_LANE_CHANGE_DELAY},
+          laneLookahead{AI_LANE_LOOKAHEAD},
+          aiSpawnRange{AI_SPAWN_Y_RANDOM_RANGE},
+          obstacleSpawnRange{OBSTACLE_SPAWN_Y_RANDOM_RANGE},
+          aiSpeedBonus{0},
+          trafficPerLap{TRAFFIC_PER_LAP},
+          startTraffic{0},
+          aiDecisionBudget{AI_DECISIONS_PER_TICK}
+    {}
+
+    /*
+     * Description: Check every field is one the simulation can run with
+     * Return: bool - true if spawn ranges are at least 1 (Random::nextInt
+     *         divides by them) and the lane change delay, lookahead and
+     *         decision budget are not negative
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool inRange() const {
+        return aiSpawnRange >= 1 && obstacleSpawnRange >= 1 &&
+               laneChangeDelay >= 0 && laneLookahead >= 0 && aiDecisionBudget >= 0;
+    }
+
+    /*
+     * Description: Raise every out-of-range field to its lowest valid value
+     * Return: RaceParams - copy that passes inRange()
+     * Pre-condition: None
+     * Post-condition: No state change; fields already in range kept
+     */
+    RaceParams clamped() const {
+        RaceParams params = *this;
+        params.aiSpawnRange = std::max(aiSpawnRange, 1);
+        params.obstacleSpawnRange = std::max(obstacleSpawnRange, 1);
+        params.laneChangeDelay = std::max(laneChangeDelay, 0);
+        params.laneLookahead = std::max(laneLookahead, 0);
+        params.aiDecisionBudget = std::max(aiDecisionBudget, 0);
+        return params;
+    }
+};
+
+#endif /* RaceParams_h */
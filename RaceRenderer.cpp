@@ -0,0 +1,53 @@
+//================================================================
+// RaceRenderer.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Race Renderer Implementation
+// Description: Effect emission per tick and the playing draw order
+//================================================================
+
+#include "RaceRenderer.h"
+
+RaceRenderer::RaceRenderer() : night{false} {}
+
+void RaceRenderer::onTick(const Simulation& sim, const TickEvents& events) {
+    random.seed(sim.getSeed(), (static_cast<uint64_t>(sim.getTick()) << 8) | RANDOM_STREAM_EFFECTS);
+    RandomScope scope(random);
+
+    if(events.frozen) {
+        effects.update(0);
+        return;
+    }
+
+    const PlayerCar& player = sim.getPlayer();
+    if(events.skid) effects.emitSkid(player);
+
+    effects.emitExhaust(player, 1 + player.getSpeed() / 5);
+    const EntityStore& entities = sim.getEntities();
+    for(int i = 0; i < entities.getAICount(); i++) effects.emitExhaust(entities.getAICar(i), 1);
+    effects.update(player.getSpeed());
+
+    if(events.crashed) effects.emitCrash(events.contact, PLAYER_CAR);
+}
+
+void RaceRenderer::draw(SDL_Plotter& g, Simulation& sim) {
+    g.setDrawSource(SOURCE_BACKGROUND);
+    sim.drawBackground(g);
+    g.setDrawSource(SOURCE_EFFECTS);
+    effects.drawGround(g);
+    g.setDrawSource(SOURCE_OBSTACLE);
+    sim.drawObstacles(g);
+    g.setDrawSource(SOURCE_CAR);
+    sim.drawCars(g);
+
+    g.setDrawSource(SOURCE_EFFECTS);
+    if(night) {
+        lighting.addCar(sim.getPlayer());
+        const EntityStore& entities = sim.getEntities();
+        for(int i = 0; i < entities.getAICount(); i++) lighting.addCar(entities.getAICar(i));
+        lighting.apply(g);
+    }
+    effects.drawGlow(g);
+
+    g.setDrawSource(SOURCE_SCREEN);
+    sim.drawHud(g);
+}
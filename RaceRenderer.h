@@ -0,0 +1,66 @@
+//================================================================
+// RaceRenderer.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Race Renderer
+// Description: Draws a Simulation with its particle effects and
+//              night lighting; shared by the game and offline tools
+//================================================================
+
+#ifndef RaceRenderer_h
+#define RaceRenderer_h
+
+#include "Simulation.h"
+#include "Particles.h"
+#include "Lighting.h"
+
+class RaceRenderer {
+private:
+    EffectsManager effects;   // Crash, skid, and exhaust particles
+    NightLighting  lighting;  // Headlight maps for night races
+    Random         random;    // Effects stream, reseeded every tick
+    bool           night;     // Night race lighting on
+
+public:
+    /*
+     * Description: Create a renderer with no live effects
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Day lighting, particle pools empty
+     */
+    RaceRenderer();
+
+    /*
+     * Description: Emit and advance effects for a tick just simulated
+     * Return: void
+     * Pre-condition: events came from sim.step() this tick
+     * Post-condition: Effects depend only on (seed, tick, state), so any
+     *                 renderer replaying the same ticks draws the same frames
+     */
+    void onTick(const Simulation& sim, const TickEvents& events);
+
+    /*
+     * Description: Draw the race frame: world, effects, lighting, HUD
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Full playing frame rendered
+     */
+    void draw(SDL_Plotter& g, Simulation& sim);
+
+    /*
+     * Description: Remove every live effect
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Particle pools empty
+     */
+    void clear() { effects.clear(); }
+
+    /*
+     * Description: Turn night lighting on or off
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: night updated
+     */
+    void setNightMode(bool flag) { night = flag; }
+};
+
+#endif /* RaceRenderer_h */
@@ -0,0 +1,76 @@
+//================================================================
+// Random.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Seeded Random Streams Implementation
+// Description: xoshiro128** stepping and per-thread current stream
+//================================================================
+
+#include "Random.h"
+#include "StateStream.h"
+
+// SPLITMIX64 - spreads one seed over the whole state
+static uint64_t splitMix(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline uint32_t rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+Random::Random(uint64_t seedValue) {
+    seed(seedValue);
+}
+
+void Random::seed(uint64_t seedValue) {
+    uint64_t a = splitMix(seedValue);
+    uint64_t b = splitMix(seedValue);
+    state[0] = static_cast<uint32_t>(a);
+    state[1] = static_cast<uint32_t>(a >> 32);
+    state[2] = static_cast<uint32_t>(b);
+    state[3] = static_cast<uint32_t>(b >> 32);
+    if((state[0] | state[1] | state[2] | state[3]) == 0) state[0] = 1;
+}
+
+void Random::seed(uint64_t seedValue, uint64_t stream) {
+    seed(seedValue ^ splitMix(stream));
+}
+
+uint32_t Random::next() {
+    uint32_t result = rotl(state[1] * 5, 7) * 9;
+    uint32_t t = state[1] << 9;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 11);
+    return result;
+}
+
+void Random::saveState(StateWriter& out) const {
+    out.put(state);
+}
+
+void Random::loadState(StateReader& in) {
+    in.get(state);
+    if((state[0] | state[1] | state[2] | state[3]) == 0) in.fail();
+}
+
+// CURRENT STREAM PER THREAD
+static thread_local Random threadDefault(0x5049584C52414345ULL);
+static thread_local Random* active = nullptr;
+
+Random& currentRandom() {
+    return active ? *active : threadDefault;
+}
+
+RandomScope::RandomScope(Random& stream) : previous{active} {
+    active = &stream;
+}
+
+RandomScope::~RandomScope() {
+    active = previous;
+}
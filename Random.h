@@ -0,0 +1,109 @@
+//================================================================
+// Random.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Seeded Random Streams
+// Description: Small xoshiro128** generator, one stream per simulation
+//              system, replacing the shared global rand()
+//================================================================
+
+#ifndef Random_h
+#define Random_h
+
+#include <cstdint>
+
+class StateWriter;  // Forward declaration
+class StateReader;  // Forward declaration
+
+// STREAM IDS - each system draws from its own stream keyed by the race
+// seed, so one system's draws never shift another's
+const uint64_t RANDOM_STREAM_AI = 1;         // Lane choices and AI respawns
+const uint64_t RANDOM_STREAM_OBSTACLES = 2;  // Obstacle respawns
+const uint64_t RANDOM_STREAM_EFFECTS = 3;    // Particles; tick number in the bits above 8
+const uint64_t RANDOM_STREAM_HANDLES = 4;    // First entity handle generation of a race
+
+class Random {
+private:
+    uint32_t state[4];  // xoshiro128** state, never all zero
+
+public:
+    /*
+     * Description: Create a stream from a 64-bit seed
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: State expanded from seed with splitmix64
+     */
+    explicit Random(uint64_t seed = 1);
+
+    /*
+     * Description: Restart the stream from a seed
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Same sequence as Random(seed)
+     */
+    void seed(uint64_t seed);
+
+    /*
+     * Description: Restart as one stream of a seed
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Sequence depends only on (seed, stream); different
+     *                 streams of one seed are unrelated
+     */
+    void seed(uint64_t seed, uint64_t stream);
+
+    /*
+     * Description: Next 32 random bits
+     * Return: uint32_t - random value
+     * Pre-condition: None
+     * Post-condition: Stream advanced one step
+     */
+    uint32_t next();
+
+    /*
+     * Description: Random integer in [0, n)
+     * Return: int - random value
+     * Pre-condition: n > 0
+     * Post-condition: Stream advanced one step
+     */
+    int nextInt(int n) { return static_cast<int>(next() % static_cast<uint32_t>(n)); }
+
+    /*
+     * Description: Random float in [0, 1]
+     * Return: float - random value
+     * Pre-condition: None
+     * Post-condition: Stream advanced one step
+     */
+    float nextUnit() { return nextInt(1001) / 1000.0f; }
+
+    /*
+     * Description: Save or restore the stream position
+     * Return: void
+     * Pre-condition: in holds what saveState wrote
+     * Post-condition: Restored stream continues the saved sequence
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
+};
+
+/*
+ * Description: Stream used by game code on the calling thread
+ * Return: Random& - stream set by the innermost RandomScope, or a
+ *         per-thread default stream
+ * Pre-condition: None
+ * Post-condition: No state change
+ */
+Random& currentRandom();
+
+// MAKES A STREAM CURRENT FOR ONE SCOPE ON THIS THREAD
+class RandomScope {
+private:
+    Random* previous;  // Stream to restore on exit
+
+public:
+    explicit RandomScope(Random& stream);
+    ~RandomScope();
+    RandomScope(const RandomScope&) = delete;
+    RandomScope& operator=(const RandomScope&) = delete;
+};
+
+#endif /* Random_h */
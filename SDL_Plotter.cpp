@@ -17,7 +17,9 @@
  */
 
 #include "SDL_Plotter.h"
+#include <algorithm>
 
+#ifndef PIXEL_RACERS_HEADLESS
 //Threaded Sound Function
 
 static int Sound(void *data){
@@ -39,6 +41,7 @@ static int Sound(void *data){
     p->running = false;
     return 0;
 }
+#endif
 
 
 // SDL Plotter Function Definitions
@@ -51,6 +54,35 @@ SDL_Plotter::SDL_Plotter(int r, int c, bool WITH_SOUND){
     SOUND = WITH_SOUND;
     currentKeyStates = NULL;
 
+    tiled      = false;
+    tilesX     = (col + TILE_MASK) >> TILE_SHIFT;
+    tilesY     = (row + TILE_MASK) >> TILE_SHIFT;
+    bufferSize = col * row;
+    scanout    = NULL;
+
+    filter     = NULL;
+    filtered   = NULL;
+    presented  = NULL;
+
+    tracking   = false;
+    heatmap    = false;
+    source     = SOURCE_SCREEN;
+    writeCount = NULL;
+    heatPixels = NULL;
+    lastTouched = 0;
+    for(int s = 0; s < SOURCE_COUNT; s++) sourceWrites[s] = lastSourceWrites[s] = 0;
+
+    pixels   = new Uint32[col * row];
+
+    memset(pixels, WHITE, col * row * sizeof(Uint32));
+    soundCount = 0;
+
+#ifdef PIXEL_RACERS_HEADLESS
+    //No window, input, or audio
+    window   = NULL;
+    renderer = NULL;
+    texture  = NULL;
+#else
     SDL_Init(SDL_INIT_AUDIO);
 
     window   = SDL_CreateWindow("SDL2 Pixel Drawing",
@@ -63,41 +95,74 @@ SDL_Plotter::SDL_Plotter(int r, int c, bool WITH_SOUND){
                                  SDL_PIXELFORMAT_ARGB8888,
                                  SDL_TEXTUREACCESS_STATIC, col, row);
 
-    pixels   = new Uint32[col * row];
-
-    memset(pixels, WHITE, col * row * sizeof(Uint32));
-
     currentKeyStates = SDL_GetKeyboardState( NULL );
 
     //SOUND Thread Pool
     Mix_OpenAudio( 44100, MIX_DEFAULT_FORMAT, 2, 2048 );
-    soundCount = 0;
+#endif
     update();
   }
 
 
 SDL_Plotter::~SDL_Plotter(){
     delete[] pixels;
+    delete[] scanout;
+    delete[] filtered;
+    delete[] writeCount;
+    delete[] heatPixels;
+#ifndef PIXEL_RACERS_HEADLESS
     SDL_DestroyTexture(texture);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
+#endif
 
 }
 
 void SDL_Plotter::update(){
-    SDL_UpdateTexture(texture, NULL, pixels, col * sizeof(Uint32));
+    Uint32* shown = pixels;
+
+    // HEATMAP - blended into a copy so retained screens stay intact
+    if(tracking && heatmap){
+        static const Uint32 HEAT[6] = { 0x000000, 0x0000FF, 0x00FF00,
+                                        0xFFFF00, 0xFF8000, 0xFF0000 };
+        for(int i = 0; i < bufferSize; i++){
+            Uint32 level = writeCount[i] < 5 ? writeCount[i] : 5;
+            heatPixels[i] = ((pixels[i] >> 1) & 0x7F7F7F) + ((HEAT[level] >> 1) & 0x7F7F7F);
+        }
+        shown = heatPixels;
+    }
+
+    if(tiled){
+        detile(shown, scanout);
+        shown = scanout;
+    }
+
+    // POST-PROCESS - written to its own buffer so the draw buffer is kept
+    if(filter != NULL){
+        if(filtered == NULL) filtered = new Uint32[col * row];
+        if(filter->process(shown, filtered, col, row)) shown = filtered;
+    }
+
+    presented = shown;
+
+#ifndef PIXEL_RACERS_HEADLESS
+    SDL_UpdateTexture(texture, NULL, shown, col * sizeof(Uint32));
     SDL_RenderClear(renderer);
     SDL_RenderCopy(renderer, texture, NULL, NULL);
     SDL_RenderPresent(renderer);
+#endif
+
+    if(tracking) endFrameCounts();
 }
 
 Uint32 SDL_Plotter::getColor(int x, int y){
-    return pixels[y * col + x];
+    return pixels[pixelIndex(x, y)];
 }
 
 
 bool SDL_Plotter::getQuit(){
+#ifndef PIXEL_RACERS_HEADLESS
     //Handle events on queue
     while( SDL_PollEvent( &event ) != 0 )
     {
@@ -128,6 +193,7 @@ bool SDL_Plotter::getQuit(){
             quit = true;
         }
     }
+#endif
     return quit;
 }
 
@@ -140,9 +206,11 @@ bool SDL_Plotter::mouseClick(){
 }
 
 
+#ifndef PIXEL_RACERS_HEADLESS
 char SDL_Plotter::getKeyPress(SDL_Event & event){
     return *event.text.text;
 }
+#endif
 
 char SDL_Plotter::getKey(){
     char key = '\0';
@@ -180,12 +248,146 @@ void SDL_Plotter::plotPixel(point p, color c){
 
 void SDL_Plotter::plotPixel(int x, int y, int r, int g, int b){
     if(x >= 0 && y >= 0 && x < col && y < row){
-        pixels[y * col + x] = RED_SHIFT*r + GREEN_SHIFT*g + BLUE_SHIFT*b;
+        int i = pixelIndex(x, y);
+        pixels[i] = RED_SHIFT*r + GREEN_SHIFT*g + BLUE_SHIFT*b;
+        if(tracking) countSpan(i, 1);
+    }
+}
+
+// Per-channel saturating add of two packed 0x00RRGGBB colors
+static inline Uint32 addSaturate(Uint32 dst, Uint32 src){
+    Uint32 rb = (dst & 0xFF00FF) + (src & 0xFF00FF);
+    Uint32 g  = (dst & 0x00FF00) + (src & 0x00FF00);
+    rb |= (rb & 0x01000100) - ((rb & 0x01000100) >> 8);
+    g  |= (g & 0x00010000) - ((g & 0x00010000) >> 8);
+    return (rb & 0xFF00FF) | (g & 0x00FF00);
+}
+
+void SDL_Plotter::plotBatch(const int* xs, const int* ys, const Uint32* colors,
+                            int count, int size, bool additive){
+    for(int i = 0; i < count; i++){
+        int x0 = xs[i] < 0 ? 0 : xs[i];
+        int y0 = ys[i] < 0 ? 0 : ys[i];
+        int x1 = xs[i] + size > col ? col : xs[i] + size;
+        int y1 = ys[i] + size > row ? row : ys[i] + size;
+
+        for(int y = y0; y < y1; y++){
+            for(int x = x0; x < x1; ){
+                int start = pixelIndex(x, y);
+                int n = min(spanLength(x), x1 - x);
+                Uint32* dst = pixels + start;
+                if(tracking) countSpan(start, n);
+                if(additive){
+                    for(int k = 0; k < n; k++) dst[k] = addSaturate(dst[k], colors[i]);
+                }
+                else{
+                    for(int k = 0; k < n; k++) dst[k] = colors[i];
+                }
+                x += n;
+            }
+        }
+    }
+}
+
+// Bit k of rowBits[r] set -> pixel (x + k, y + r) gets color c
+void SDL_Plotter::plotMask(int x, int y, const Uint32* rowBits, int rows, int width, color c){
+    const Uint32 value = RED_SHIFT*c.R + GREEN_SHIFT*c.G + BLUE_SHIFT*c.B;
+    const int chunks = (width + 15) / 16;
+    const bool inside = !tiled && x >= 0 && x + chunks * 16 <= col;
+
+    for(int r = 0; r < rows; r++){
+        Uint32 bits = rowBits[r];
+        int py = y + r;
+        if(bits == 0 || py < 0 || py >= row) continue;
+        if(tracking) countMask(x, py, bits, width);
+
+        if(tiled){
+            // ONE CONTIGUOUS TILE ROW AT A TIME
+            int b0 = x < 0 ? -x : 0;
+            int b1 = x + width > col ? col - x : width;
+            for(int b = b0; b < b1; ){
+                Uint32* dst = pixels + pixelIndex(x + b, py);
+                int n = min(spanLength(x + b), b1 - b);
+                for(int k = 0; k < n; k++){
+                    Uint32 m = 0u - ((bits >> (b + k)) & 1u);
+                    dst[k] = (dst[k] & ~m) | (value & m);
+                }
+                b += n;
+            }
+        }
+        else if(inside){
+            Uint32* dst = pixels + py * col + x;
+            // EXPAND 16 PIXELS AT A TIME (branch-free select per lane)
+            for(int k = 0; k < chunks; k++, bits >>= 16, dst += 16){
+                Uint32 chunk = bits & 0xFFFF;
+                if(chunk == 0) continue;
+                for(int b = 0; b < 16; b++){
+                    Uint32 m = 0u - ((chunk >> b) & 1u);
+                    dst[b] = (dst[b] & ~m) | (value & m);
+                }
+            }
+        }
+        else{
+            for(int b = 0; b < width; b++){
+                if(((bits >> b) & 1u) && x + b >= 0 && x + b < col){
+                    pixels[pixelIndex(x + b, py)] = value;
+                }
+            }
+        }
+    }
+}
+
+void SDL_Plotter::fillRect(int x, int y, int w, int h, color c){
+    const Uint32 value = RED_SHIFT*c.R + GREEN_SHIFT*c.G + BLUE_SHIFT*c.B;
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + w > col ? col : x + w;
+    int y1 = y + h > row ? row : y + h;
+
+    if(tiled){
+        fillTiles(x0, y0, x1, y1, value);
+        return;
+    }
+
+    for(int py = y0; py < y1; py++){
+        for(int px = x0; px < x1; ){
+            int start = pixelIndex(px, py);
+            int n = min(spanLength(px), x1 - px);
+            Uint32* dst = pixels + start;
+            for(int k = 0; k < n; k++) dst[k] = value;
+            if(tracking) countSpan(start, n);
+            px += n;
+        }
+    }
+}
+
+// Scale every channel by min(light + ambient, 255) / 255, one pass
+void SDL_Plotter::multiplyLight(const Uint8* light, int ambient){
+    for(int y = 0; y < row; y++){
+        for(int x = 0; x < col; ){
+            int start = pixelIndex(x, y);
+            int n = min(spanLength(x), col - x);
+            Uint32* dst = pixels + start;
+            const Uint8* src = light + y * col + x;
+            for(int k = 0; k < n; k++){
+                Uint32 l = src[k] + ambient;
+                l = (l > 255 ? 255 : l) + 1;
+                Uint32 c = dst[k];
+                dst[k] = (((c & 0xFF00FF) * l >> 8) & 0xFF00FF) |
+                         (((c & 0x00FF00) * l >> 8) & 0x00FF00);
+            }
+            if(tracking) countSpan(start, n);
+            x += n;
+        }
     }
 }
 
 void SDL_Plotter::clear(){
-         memset(pixels, WHITE, col * row * sizeof(Uint32));
+         memset(pixels, WHITE, bufferSize * sizeof(Uint32));
+         if(tracking){
+             countSpan(0, bufferSize);
+             sourceWrites[source] -= bufferSize - row * col;  // Tile padding is never shown
+         }
 }
 
 int SDL_Plotter::getRow(){
@@ -197,6 +399,7 @@ int SDL_Plotter::getCol(){
 }
 
 void SDL_Plotter::initSound(string sound){
+#ifndef PIXEL_RACERS_HEADLESS
     if(!soundMap[sound].running){
             param* p = &soundMap[sound];
             p->name = sound;
@@ -205,6 +408,7 @@ void SDL_Plotter::initSound(string sound){
 
             p->threadID = SDL_CreateThread( Sound, sound.c_str(), (void*)p );
     }
+#endif
 }
 
 void SDL_Plotter::setQuit(bool flag){
@@ -212,24 +416,31 @@ void SDL_Plotter::setQuit(bool flag){
 }
 
 void SDL_Plotter::playSound(string sound){
+#ifndef PIXEL_RACERS_HEADLESS
     if(soundMap[sound].running){
         SDL_CondSignal(soundMap[sound].cond);
     }
+#endif
 }
 
 void SDL_Plotter::quitSound(string sound){
     soundMap[sound].running = false;
+#ifndef PIXEL_RACERS_HEADLESS
     SDL_CondSignal(soundMap[sound].cond);
+#endif
 }
 
 void SDL_Plotter::Sleep(int ms){
+#ifndef PIXEL_RACERS_HEADLESS
     SDL_Delay(ms);
+#endif
 }
 
 
 bool SDL_Plotter::getMouseDown(int& x, int& y){
         bool flag = false;
         x = y = 0;
+#ifndef PIXEL_RACERS_HEADLESS
         if(SDL_PollEvent(&event)){
             if(event.type == SDL_MOUSEBUTTONDOWN){
                 //Get mouse position
@@ -240,12 +451,14 @@ bool SDL_Plotter::getMouseDown(int& x, int& y){
                 SDL_PushEvent(&event);
             }
         }
+#endif
         return flag;
 }
 
 bool SDL_Plotter::getMouseUp(int& x, int& y){
         bool flag = false;
         x = y = 0;
+#ifndef PIXEL_RACERS_HEADLESS
         if(SDL_PollEvent(&event)){
             if(event.type == SDL_MOUSEBUTTONUP){
                 //Get mouse position
@@ -256,12 +469,14 @@ bool SDL_Plotter::getMouseUp(int& x, int& y){
                 SDL_PushEvent(&event);
             }
         }
+#endif
         return flag;
 }
 
 bool SDL_Plotter::getMouseMotion(int& x, int& y){
         bool flag = false;
         x = y = 0;
+#ifndef PIXEL_RACERS_HEADLESS
         if(SDL_PollEvent(&event)){
             if(event.type == SDL_MOUSEMOTION){
                 //Get mouse position
@@ -272,10 +487,192 @@ bool SDL_Plotter::getMouseMotion(int& x, int& y){
                 SDL_PushEvent(&event);
             }
         }
+#endif
         return flag;
 }
 
+// Overdraw Instrumentation
+
+const char* getDrawSourceName(DrawSource source){
+    static const char* NAMES[SOURCE_COUNT] = { "screen", "background", "car",
+                                               "obstacle", "font", "effects" };
+    return source >= 0 && source < SOURCE_COUNT ? NAMES[source] : "unknown";
+}
+
+void SDL_Plotter::countSpan(int start, int length){
+    Uint16* count = writeCount + start;
+    for(int i = 0; i < length; i++){
+        if(count[i] != 0xFFFF) count[i]++;
+    }
+    sourceWrites[source] += length;
+}
+
+void SDL_Plotter::countMask(int x, int y, Uint32 bits, int width){
+    for(int b = 0; b < width; b++){
+        if(((bits >> b) & 1u) && x + b >= 0 && x + b < col){
+            countSpan(pixelIndex(x + b, y), 1);
+        }
+    }
+}
+
+// Latch this frame's totals and start counting the next one
+void SDL_Plotter::endFrameCounts(){
+    lastTouched = 0;
+    for(int y = 0; y < row; y++){
+        for(int x = 0; x < col; x++){
+            if(writeCount[pixelIndex(x, y)] != 0) lastTouched++;
+        }
+    }
+    memset(writeCount, 0, bufferSize * sizeof(Uint16));
+    for(int s = 0; s < SOURCE_COUNT; s++){
+        lastSourceWrites[s] = sourceWrites[s];
+        sourceWrites[s] = 0;
+    }
+}
+
+void SDL_Plotter::setOverdrawTracking(bool flag){
+    if(flag && writeCount == NULL){
+        writeCount = new Uint16[bufferSize];
+        heatPixels = new Uint32[bufferSize];
+    }
+    if(flag && !tracking){
+        memset(writeCount, 0, bufferSize * sizeof(Uint16));
+        for(int s = 0; s < SOURCE_COUNT; s++) sourceWrites[s] = lastSourceWrites[s] = 0;
+        lastTouched = 0;
+    }
+    tracking = flag;
+}
+
+bool SDL_Plotter::getOverdrawTracking(){
+    return tracking;
+}
+
+void SDL_Plotter::setOverdrawHeatmap(bool flag){
+    heatmap = flag;
+}
+
+void SDL_Plotter::setDrawSource(DrawSource s){
+    source = s;
+}
+
+DrawSource SDL_Plotter::getDrawSource(){
+    return source;
+}
+
+long SDL_Plotter::getFrameWrites(DrawSource s){
+    return lastSourceWrites[s];
+}
+
+long SDL_Plotter::getFrameWrites(){
+    long total = 0;
+    for(int s = 0; s < SOURCE_COUNT; s++) total += lastSourceWrites[s];
+    return total;
+}
+
+long SDL_Plotter::getFrameTouched(){
+    return lastTouched;
+}
+
+// Post-Process Hook
+
+void SDL_Plotter::setFrameFilter(FrameFilter* f){
+    filter = f;
+}
+
+const Uint32* SDL_Plotter::getFrame(){
+    return presented;
+}
+
+FrameFilter* SDL_Plotter::getFrameFilter(){
+    return filter;
+}
+
+// Tiled Layout
+
+// Copy tile rows (one cache line each at 16x16) into row-major order
+void SDL_Plotter::detile(const Uint32* src, Uint32* dst){
+    const int full = col >> TILE_SHIFT;
+    const int rest = col & TILE_MASK;
+    for(int y = 0; y < row; y++){
+        const Uint32* tileRow = src + ((y >> TILE_SHIFT) * tilesX << (2 * TILE_SHIFT))
+                                    + ((y & TILE_MASK) << TILE_SHIFT);
+        Uint32* out = dst + y * col;
+        for(int t = 0; t < full; t++){
+            memcpy(out + (t << TILE_SHIFT), tileRow + (t << (2 * TILE_SHIFT)),
+                   TILE_SIZE * sizeof(Uint32));
+        }
+        if(rest){
+            memcpy(out + (full << TILE_SHIFT), tileRow + (full << (2 * TILE_SHIFT)),
+                   rest * sizeof(Uint32));
+        }
+    }
+}
+
+// Fill tile by tile; rows of a fully covered tile width are contiguous
+void SDL_Plotter::fillTiles(int x0, int y0, int x1, int y1, Uint32 value){
+    for(int ty = y0 >> TILE_SHIFT; ty <= (y1 - 1) >> TILE_SHIFT && y0 < y1; ty++){
+        int ay0 = max(y0, ty << TILE_SHIFT);
+        int ay1 = min(y1, (ty + 1) << TILE_SHIFT);
+        for(int tx = x0 >> TILE_SHIFT; tx <= (x1 - 1) >> TILE_SHIFT && x0 < x1; tx++){
+            int ax0 = max(x0, tx << TILE_SHIFT);
+            int ax1 = min(x1, (tx + 1) << TILE_SHIFT);
+            int start = tileIndex(ax0, ay0);
+
+            if(ax1 - ax0 == TILE_SIZE){
+                int n = (ay1 - ay0) << TILE_SHIFT;
+                for(int k = 0; k < n; k++) pixels[start + k] = value;
+                if(tracking) countSpan(start, n);
+            }
+            else{
+                for(int y = ay0; y < ay1; y++, start += TILE_SIZE){
+                    for(int k = 0; k < ax1 - ax0; k++) pixels[start + k] = value;
+                    if(tracking) countSpan(start, ax1 - ax0);
+                }
+            }
+        }
+    }
+}
+
+// Switch draw buffer layout, keeping the current frame
+void SDL_Plotter::setTiledLayout(bool flag){
+    if(flag == tiled) return;
+
+    int newSize = flag ? (tilesX * tilesY) << (2 * TILE_SHIFT) : col * row;
+    Uint32* next = new Uint32[newSize];
+    memset(next, WHITE, newSize * sizeof(Uint32));
+
+    for(int y = 0; y < row; y++){
+        for(int x = 0; x < col; x++){
+            if(flag) next[tileIndex(x, y)] = pixels[y * col + x];
+            else     next[y * col + x] = pixels[tileIndex(x, y)];
+        }
+    }
+
+    delete[] pixels;
+    pixels = next;
+    tiled = flag;
+    bufferSize = newSize;
+    if(tiled && scanout == NULL) scanout = new Uint32[col * row];
+
+    //Counters follow the buffer layout
+    if(writeCount != NULL){
+        delete[] writeCount;
+        delete[] heatPixels;
+        writeCount = new Uint16[bufferSize];
+        heatPixels = new Uint32[bufferSize];
+        memset(writeCount, 0, bufferSize * sizeof(Uint16));
+    }
+}
+
+bool SDL_Plotter::getTiledLayout(){
+    return tiled;
+}
+
 void SDL_Plotter::getMouseLocation(int& x, int& y){
+#ifdef PIXEL_RACERS_HEADLESS
+    x = y = 0;
+#else
     SDL_GetMouseState( &x, &y );
+#endif
     cout << x << " " << y << endl;
 }
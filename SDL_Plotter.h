@@ -1,6 +1,30 @@
 /*
  * SDL_Plotter.h
  *
+ * Version 3.6
+ * Add: PIXEL_RACERS_HEADLESS build with no window, input, or sound
+ * Add: last presented frame access
+ * 10/18/2026
+ *
+ * Version 3.5
+ * Add: frame filter hook run on the finished frame at update
+ * 10/18/2026
+ *
+ * Version 3.4
+ * Add: optional 16x16 tiled draw buffer, de-tiled at update
+ * 10/18/2026
+ *
+ * Version 3.3
+ * Add: per-pixel and per-source write counters with overdraw heatmap
+ * Add: per-pixel light multiply
+ * 10/18/2026
+ *
+ * Version 3.2
+ * Add: batched point/quad plotting with additive blend
+ * Add: 1-bit mask blit for glyph rendering
+ * Add: clipped rectangle fill
+ * 10/18/2026
+ *
  * Version 3.1
  * Add: color and point constructors
  * 12/14/2022
@@ -28,9 +52,23 @@
 //#include <SDL2/SDL_mixer.h>
 //#include <SDL2/SDL_thread.h>
 
+#ifdef PIXEL_RACERS_HEADLESS
+//Headless Library (frames stay in memory)
+#include <stdint.h>
+typedef uint8_t  Uint8;
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+struct SDL_Texture;
+struct SDL_Renderer;
+struct SDL_Window;
+struct SDL_Thread;
+struct SDL_cond;
+struct SDL_mutex;
+#else
 //Windows Library
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
+#endif
 
 #include <string.h>
 #include <iostream>
@@ -50,6 +88,9 @@ const int BLUE_SHIFT   = 1;
 const int ALPHA_SHIFT  = 16777216;
 const int WHITE        = 255;
 const int MAX_THREAD   = 100;
+const int TILE_SHIFT   = 4;
+const int TILE_SIZE    = 1 << TILE_SHIFT;
+const int TILE_MASK    = TILE_SIZE - 1;
 
 
 //Point
@@ -79,6 +120,19 @@ struct color{
     }
 };
 
+//Draw Call Sources (for overdraw instrumentation)
+enum DrawSource{
+    SOURCE_SCREEN,
+    SOURCE_BACKGROUND,
+    SOURCE_CAR,
+    SOURCE_OBSTACLE,
+    SOURCE_FONT,
+    SOURCE_EFFECTS,
+    SOURCE_COUNT
+};
+
+const char* getDrawSourceName(DrawSource source);
+
 //Threaded Sound Function
 struct param{
     bool play;
@@ -101,14 +155,25 @@ struct param{
 };
 
 
+//Post-Process Hook
+class FrameFilter{
+public:
+    //Filter a finished row-major frame; return false to show src unchanged
+    virtual bool process(const Uint32* src, Uint32* dst, int width, int height) = 0;
+    virtual ~FrameFilter(){}
+};
+
 class SDL_Plotter{
 private:
     SDL_Texture  *texture;
     SDL_Renderer *renderer;
     SDL_Window   *window;
     Uint32       *pixels;
+    Uint32       *scanout;
     const Uint8  *currentKeyStates;
+#ifndef PIXEL_RACERS_HEADLESS
     SDL_Event    event;
+#endif
     int          row, col;
     bool         quit;
 
@@ -123,7 +188,52 @@ private:
     int soundCount;
     map<string, param> soundMap;
 
+#ifndef PIXEL_RACERS_HEADLESS
     char getKeyPress(SDL_Event & event);
+#endif
+
+    //Layout Stuff
+    bool tiled;
+    int  tilesX, tilesY;
+    int  bufferSize;
+
+    //Index of (x, y) in a tiled buffer
+    int tileIndex(int x, int y) const{
+        return (((y >> TILE_SHIFT) * tilesX + (x >> TILE_SHIFT)) << (2 * TILE_SHIFT))
+               + ((y & TILE_MASK) << TILE_SHIFT) + (x & TILE_MASK);
+    }
+
+    //Index of (x, y) in the draw buffer
+    int pixelIndex(int x, int y) const{
+        return tiled ? tileIndex(x, y) : y * col + x;
+    }
+
+    //Pixels contiguous in memory from (x, y) along the row
+    int spanLength(int x) const{
+        return tiled ? TILE_SIZE - (x & TILE_MASK) : col - x;
+    }
+
+    void detile(const Uint32* src, Uint32* dst);
+    void fillTiles(int x0, int y0, int x1, int y1, Uint32 value);
+
+    //Post-Process Stuff
+    FrameFilter *filter;
+    Uint32      *filtered;
+    const Uint32 *presented;
+
+    //Overdraw Stuff
+    bool       tracking;
+    bool       heatmap;
+    DrawSource source;
+    Uint16     *writeCount;
+    Uint32     *heatPixels;
+    long       sourceWrites[SOURCE_COUNT];
+    long       lastSourceWrites[SOURCE_COUNT];
+    long       lastTouched;
+
+    void countSpan(int start, int length);
+    void countMask(int x, int y, Uint32 bits, int width);
+    void endFrameCounts();
 
 public:
     SDL_Plotter(int r=480, int c=640, bool WITH_SOUND = true);
@@ -142,6 +252,11 @@ public:
     void plotPixel(point p, int r, int g, int b);
     void plotPixel(int x, int y, color=color{});
     void plotPixel(point p, color=color{});
+    void plotBatch(const int* xs, const int* ys, const Uint32* colors,
+                   int count, int size, bool additive);
+    void plotMask(int x, int y, const Uint32* rowBits, int rows, int width, color c);
+    void fillRect(int x, int y, int w, int h, color c);
+    void multiplyLight(const Uint8* light, int ambient);
 
     void clear();
     int getRow();
@@ -160,6 +275,37 @@ public:
 
     Uint32 getColor(int x, int y);
 
+    void setFrameFilter(FrameFilter* f);
+    FrameFilter* getFrameFilter();
+
+    //Row-major frame shown by the last update (after filters)
+    const Uint32* getFrame();
+
+    void setTiledLayout(bool flag);
+    bool getTiledLayout();
+
+    void setOverdrawTracking(bool flag);
+    bool getOverdrawTracking();
+    void setOverdrawHeatmap(bool flag);
+    void setDrawSource(DrawSource s);
+    DrawSource getDrawSource();
+    long getFrameWrites(DrawSource s);
+    long getFrameWrites();
+    long getFrameTouched();
+
+};
+
+//Sets the draw source for one scope, restoring the previous one on exit
+struct DrawSourceScope{
+    SDL_Plotter& plotter;
+    DrawSource   previous;
+
+    DrawSourceScope(SDL_Plotter& g, DrawSource s) : plotter(g), previous(g.getDrawSource()){
+        plotter.setDrawSource(s);
+    }
+    ~DrawSourceScope(){
+        plotter.setDrawSource(previous);
+    }
 };
 
 #endif // SDL_PLOTTER_H_
@@ -6,6 +6,7 @@
 //================================================================
 
 #include "Screen.h"
+#include "StateStream.h"
 #include <string>
 #include <cctype>
 #include <algorithm>
@@ -13,29 +14,26 @@
 using namespace std;
 
 // START SCREEN
-StartScreen::StartScreen() {}
+StartScreen::StartScreen() {
+    int bg = ui.addPanel(-1, 0, 0, ROW, COL, BG_START);
+    ui.addScaledLabel(bg, (ROW - FontRenderer::measureScaled("PIXEL RACERS", TITLE_SCALE)) / 2, COL / 2 - 100,
+                      "PIXEL RACERS", TITLE_SCALE, YELLOW);
+    ui.addLabel(bg, 100, COL / 2 - 15, "Press I for Instructions", FONT_SMALL, WHITE2, true);
+    ui.addLabel(bg, 155, COL / 2 + 15, "Press S to START", FONT_SMALL, WHITE2, true);
+    ui.addLabel(bg, 10, COL - 40, "Press M for Infinite Mode", FONT_SMALL, CYAN, true);
+    ui.addLabel(bg, 10, COL - 70, "Press N for Night Race", FONT_SMALL, CYAN, true);
+    modeLabel = ui.addLabel(bg, 200, 20, "NORMAL MODE", FONT_SMALL, color(255, 100, 0));
+    nightLabel = ui.addLabel(bg, 215, 45, "NIGHT RACE", FONT_SMALL, color(140, 140, 255));
+    ui.setVisible(nightLabel, false);
+}
 
 void StartScreen::update() {
     flashTimer++;
+    ui.update(flashTimer);
 }
 
 void StartScreen::draw(SDL_Plotter& g) {
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_START);
-        }
-    }
-    FontRenderer::drawLarge(g, 110, COL / 2 - 80, YELLOW, "PIXEL RACERS", 0);
-    FontRenderer::drawSmall(g, 100, COL / 2 - 15, WHITE2, "Press I for Instructions", flashTimer);
-    FontRenderer::drawSmall(g, 155, COL / 2 + 15, WHITE2, "Press S to START", flashTimer);
-    FontRenderer::drawSmall(g, 10, COL - 40, CYAN, "Press M for Infinite Mode", flashTimer);
-
-    if (infiniteMode) {
-        FontRenderer::drawSmall(g, 200, 20, color(0, 255, 0), "INFINITE MODE", 0);
-    } else {
-        FontRenderer::drawSmall(g, 200, 20, color(255, 100, 0), "NORMAL MODE", 0);
-    }
-
+    ui.render(g);
 }
 
 bool StartScreen::handleInput(char key) {
@@ -44,36 +42,45 @@ bool StartScreen::handleInput(char key) {
 
 void StartScreen::setInfiniteMode(bool enable) {
     infiniteMode = enable;
+    if (infiniteMode) {
+        ui.setText(modeLabel, "INFINITE MODE");
+        ui.setColor(modeLabel, color(0, 255, 0));
+    } else {
+        ui.setText(modeLabel, "NORMAL MODE");
+        ui.setColor(modeLabel, color(255, 100, 0));
+    }
+}
+
+void StartScreen::setNightMode(bool enable) {
+    ui.setVisible(nightLabel, enable);
 }
 
 // INSTRUCTIONS SCREEN
-InstructionsScreen::InstructionsScreen() : scrollOffset{0} {}
+InstructionsScreen::InstructionsScreen() : scrollOffset{0} {
+    int bg = ui.addPanel(-1, 0, 0, ROW, COL, BG_INSTRUCTIONS);
+    ui.addLabel(bg, 30, 40, "CONTROLS", FONT_LARGE, CYAN);
+    ui.addLabel(bg, 30, 90, "UP: Accelerate", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 130, "DOWN: Brake", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 170, "LEFT/RIGHT: Steer", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 210, "Pass cars = 10pts", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 250, "Obstacles = CRASH", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 300, "INFINITE MODE:", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 340, "M at start: Infinite Mode", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, 380, "Q while playing: End Game", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 30, COL - 90, "Press S to START", FONT_SMALL, CYAN);
+    ui.addLabel(bg, 30, COL - 130, "Press B to go BACK", FONT_SMALL, CYAN);
+}
 
 void InstructionsScreen::update() {
     scrollOffset++;
     if(scrollOffset > SCROLL_RESET_VALUE) {
         scrollOffset = 0;
     }
+    ui.update(flashTimer);
 }
 
 void InstructionsScreen::draw(SDL_Plotter& g) {
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_INSTRUCTIONS);
-        }
-    }
-    FontRenderer::drawLarge(g, 30, 40, CYAN, "CONTROLS", 0);
-    FontRenderer::drawSmall(g, 30, 90, WHITE2, "UP: Accelerate", 0);
-    FontRenderer::drawSmall(g, 30, 130, WHITE2, "DOWN: Brake", 0);
-    FontRenderer::drawSmall(g, 30, 170, WHITE2, "LEFT/RIGHT: Steer", 0);
-    FontRenderer::drawSmall(g, 30, 210, WHITE2, "Pass cars = 10pts", 0);
-    FontRenderer::drawSmall(g, 30, 250, WHITE2, "Obstacles = CRASH", 0);
-    FontRenderer::drawSmall(g, 30, 300, WHITE2, "INFINITE MODE:", 0);
-    FontRenderer::drawSmall(g, 30, 340, WHITE2, "M at start: Infinite Mode", 0);
-    FontRenderer::drawSmall(g, 30, 380, WHITE2, "Q while playing: End Game", 0);
-    FontRenderer::drawSmall(g, 30, COL - 90, CYAN, "Press S to START", 0);
-    FontRenderer::drawSmall(g, 30, COL - 130, CYAN, "Press B to go BACK", 0);
-
+    ui.render(g);
 }
 
 bool InstructionsScreen::handleInput(char key) {
@@ -81,21 +88,20 @@ bool InstructionsScreen::handleInput(char key) {
 }
 
 // PAUSE SCREEN
-PauseScreen::PauseScreen() {}
+PauseScreen::PauseScreen() {
+    int bg = ui.addPanel(-1, 0, 0, ROW, COL, BG_PAUSED);
+    ui.addLabel(bg, 200, COL / 2 - 30, "PAUSED", FONT_LARGE, YELLOW);
+    ui.addLabel(bg, 150, COL / 2 + 20, "Press P to Resume", FONT_SMALL, YELLOW, true);
+    ui.addLabel(bg, 140, COL / 2 + 50, "Press B to go BACK", FONT_SMALL, CYAN, true);
+}
 
 void PauseScreen::update() {
     flashTimer++;
+    ui.update(flashTimer);
 }
 
 void PauseScreen::draw(SDL_Plotter& g) {
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_PAUSED);
-        }
-    }
-    FontRenderer::drawLarge(g, 200, COL / 2 - 30, YELLOW, "PAUSED", 0);
-    FontRenderer::drawSmall(g, 150, COL / 2 + 20, YELLOW, "Press P to Resume", flashTimer);
-    FontRenderer::drawSmall(g, 140, COL / 2 + 50, CYAN, "Press B to go BACK", flashTimer);
+    ui.render(g);
 }
 
 bool PauseScreen::handleInput(char key) {
@@ -107,6 +113,26 @@ PlayingScreen::PlayingScreen(bool infinite) : currentLap{1}, infiniteMode{infini
     maxLaps = infinite ? -1 : 3;
 }
 
+void PlayingScreen::restart(bool infinite) {
+    currentLap = 1;
+    flashTimer = 0;
+    setInfiniteMode(infinite);
+}
+
+void PlayingScreen::saveState(StateWriter& out) const {
+    out.put(currentLap);
+    out.put(maxLaps);
+    out.put(infiniteMode);
+    out.put(flashTimer);
+}
+
+void PlayingScreen::loadState(StateReader& in) {
+    in.get(currentLap);
+    in.get(maxLaps);
+    in.get(infiniteMode);
+    in.get(flashTimer);
+}
+
 void PlayingScreen::update() {
     flashTimer++;
 }
@@ -127,22 +153,23 @@ void PlayingScreen::draw(SDL_Plotter& g) {
 
 void PlayingScreen::draw(SDL_Plotter& g, PointsManager& points, PlayerCar& playerCar) {
     color hudColor(255, 255, 255);
-    string scoreStr = "Score:";
-    string scoreStr2 = to_string(points.getScore());
-    string speedStr = "Speed:";
-    string speedStr2 = to_string(playerCar.getSpeed());
 
-    string lapStr;
-    if (infiniteMode) {
-        lapStr = "Lap:" + to_string(currentLap);
-    } else {
-        lapStr = "Lap:" + to_string(currentLap) + "/" + to_string(maxLaps);
+    scoreRun.set(points.getScore());
+    speedRun.set(playerCar.getSpeed());
+
+    // LAP LABEL - built in a fixed buffer, no allocation
+    char lapStr[32] = "Lap:";
+    int length = 4;
+    length += formatNumber(currentLap, lapStr + length, sizeof(lapStr) - length);
+    if (!infiniteMode) {
+        lapStr[length++] = '/';
+        formatNumber(maxLaps, lapStr + length, sizeof(lapStr) - length);
     }
 
-    FontRenderer::drawSmall(g, 10, 20, hudColor, scoreStr, 0);
-    FontRenderer::drawSmall(g, 10, 50, hudColor, scoreStr2, 0);
-    FontRenderer::drawSmall(g, 10, 80, hudColor, speedStr, 0);
-    FontRenderer::drawSmall(g, 10, 110, hudColor, speedStr2, 0);
+    FontRenderer::drawSmall(g, 10, 20, hudColor, "Score:", 0);
+    scoreRun.draw(g, 10, 50, hudColor);
+    FontRenderer::drawSmall(g, 10, 80, hudColor, "Speed:", 0);
+    speedRun.draw(g, 10, 110, hudColor);
     FontRenderer::drawSmall(g, 10, 140, hudColor, lapStr, 0);
 
     if (infiniteMode) {
@@ -164,38 +191,44 @@ bool PlayingScreen::isWinCondition() const {
 }
 
 // GAME OVER SCREEN
-GameOverScreen::GameOverScreen() : hitAI{false}, hitObstacle{false} {}
+GameOverScreen::GameOverScreen() : hitAI{false}, hitObstacle{false} {
+    int bg = ui.addPanel(-1, 0, 0, ROW, COL, BG_GAME_OVER);
+    ui.addScaledLabel(bg, (ROW - FontRenderer::measureScaled("GAME OVER", TITLE_SCALE)) / 2, COL / 2 - 90,
+                      "GAME OVER", TITLE_SCALE, RED);
+    ui.addLabel(bg, 160, COL / 2 - 20, "Final Score: ", FONT_SMALL, WHITE2);
+    scoreLabel = ui.addLabel(bg, 360, COL / 2 - 20, "0", FONT_SMALL, WHITE2);
+    aiLabel = ui.addLabel(bg, 190, COL / 2 + 10, "Hit AI Car!", FONT_SMALL, AI_BLUE, true);
+    obstacleLabel = ui.addLabel(bg, 180, COL / 2 + 10, "Hit Obstacle!", FONT_SMALL, ORANGE, true);
+    ui.addLabel(bg, 140, COL - 90, "Press C to Restart", FONT_SMALL, WHITE2, true);
+    ui.addLabel(bg, 142, COL - 60, "R: Retry  L: Last Lap", FONT_SMALL, CYAN);
+    ui.setVisible(aiLabel, false);
+    ui.setVisible(obstacleLabel, false);
+}
 
 void GameOverScreen::setGameOver(int score, bool aiHit, bool obstacleHit) {
     finalScore = score;
     hitAI = aiHit;
     hitObstacle = obstacleHit;
+
+    char scoreStr[NUMBER_RUN_MAX_DIGITS + 1];
+    formatNumber(finalScore, scoreStr, sizeof(scoreStr));
+    ui.setText(scoreLabel, scoreStr);
+
+    // OBSTACLE LINE MOVES DOWN WHEN BOTH ARE SHOWN
+    int yPos = COL / 2 + 10;
+    ui.setVisible(aiLabel, hitAI);
+    if(hitAI) yPos += GAME_OVER_Y_SPACING;
+    ui.setPosition(obstacleLabel, 180, yPos);
+    ui.setVisible(obstacleLabel, hitObstacle);
 }
 
 void GameOverScreen::update() {
     flashTimer++;
+    ui.update(flashTimer);
 }
 
 void GameOverScreen::draw(SDL_Plotter& g) {
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_GAME_OVER);
-        }
-    }
-    FontRenderer::drawLarge(g, 150, COL / 2 - 70, RED, "GAME OVER", 0);
-    FontRenderer::drawSmall(g, 160, COL / 2 - 20, WHITE2, "Final Score: ", 0);
-    string scoreStr = to_string(finalScore);
-    FontRenderer::drawSmall(g, 360, COL / 2 - 20, WHITE2, scoreStr, 0);
-
-    int yPos = COL / 2 + 10;
-    if(hitAI) {
-        FontRenderer::drawSmall(g, 190, yPos, AI_BLUE, "Hit AI Car!", flashTimer);
-        yPos += GAME_OVER_Y_SPACING;
-    }
-    if(hitObstacle) {
-        FontRenderer::drawSmall(g, 180, yPos, ORANGE, "Hit Obstacle!", flashTimer);
-    }
-    FontRenderer::drawSmall(g, 140, COL - 90, WHITE2, "Press C to Restart", flashTimer);
+    ui.render(g);
 }
 
 bool GameOverScreen::handleInput(char key) {
@@ -203,27 +236,31 @@ bool GameOverScreen::handleInput(char key) {
 }
 
 // WIN SCREEN
-WinScreen::WinScreen() {}
+WinScreen::WinScreen() {
+    int bg = ui.addPanel(-1, 0, 0, ROW, COL, BG_WIN);
+    ui.addScaledLabel(bg, (ROW - FontRenderer::measureScaled("YOU WIN!", TITLE_SCALE)) / 2, COL / 2 - 90,
+                      "YOU WIN!", TITLE_SCALE, GREEN);
+    ui.addLabel(bg, 160, COL / 2 - 20, "Final Score: ", FONT_SMALL, WHITE2);
+    scoreLabel = ui.addLabel(bg, 360, COL / 2 - 20, "0", FONT_SMALL, WHITE2);
+    ui.addLabel(bg, 140, COL - 90, "Press C to Restart", FONT_SMALL, CYAN, true);
+    ui.addLabel(bg, 240, COL - 60, "R: Retry", FONT_SMALL, WHITE2);
+}
 
 void WinScreen::setWin(int score) {
     finalScore = score;
+
+    char scoreStr[NUMBER_RUN_MAX_DIGITS + 1];
+    formatNumber(finalScore, scoreStr, sizeof(scoreStr));
+    ui.setText(scoreLabel, scoreStr);
 }
 
 void WinScreen::update() {
     flashTimer++;
+    ui.update(flashTimer);
 }
 
 void WinScreen::draw(SDL_Plotter& g) {
-    for(int x = 0; x < ROW; x++) {
-        for(int y = 0; y < COL; y++) {
-            g.plotPixel(x, y, BG_WIN);
-        }
-    }
-    FontRenderer::drawLarge(g, 150, COL / 2 - 70, GREEN, "YOU WIN!", 0);
-    FontRenderer::drawSmall(g, 160, COL / 2 - 20, WHITE2, "Final Score: ", 0);
-    string scoreStr = to_string(finalScore);
-    FontRenderer::drawSmall(g, 360, COL / 2 - 20, WHITE2, scoreStr, 0);
-    FontRenderer::drawSmall(g, 140, COL - 90, CYAN, "Press C to Restart", flashTimer);
+    ui.render(g);
 }
 
 bool WinScreen::handleInput(char key) {
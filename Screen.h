@@ -10,14 +10,20 @@
 
 #include "Const.h"
 #include "Font.h"
+#include "TextCache.h"
+#include "UI.h"
 #include "Points.h"
 #include "Car.h"
 
+class StateWriter;  // Forward declaration
+class StateReader;  // Forward declaration
+
 // BASE SCREEN CLASS
 class Screen {
 protected:
     int finalScore; // Final player score
     int flashTimer; // Timer for flashing text effects
+    UITree ui;      // Retained panels and labels (menu screens)
 
 public:
     /*
@@ -52,6 +58,14 @@ public:
      */
     virtual bool handleInput(char key) = 0;
 
+    /*
+     * Description: Prepare screen for display after a state change
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Next draw repaints the whole screen
+     */
+    void enter() { ui.invalidate(); }
+
     /*
      * Description: Virtual destructor
      * Return: None (destructor)
@@ -65,6 +79,8 @@ public:
 class StartScreen : public Screen {
 private:
 	bool infiniteMode = false; // Infinite Mode Toggle
+	int  modeLabel;            // UI node showing current mode
+	int  nightLabel;           // UI node shown when night race is on
 
 public:
     /*
@@ -79,7 +95,7 @@ public:
      * Description: Update start screen animations
      * Return: void
      * Pre-condition: None
-     * Post-condition: flashTimer incremented
+     * Post-condition: flashTimer incremented, flashing labels damaged on toggle
      */
     void update() override;
 
@@ -87,7 +103,7 @@ public:
      * Description: Draw start screen with title and instructions
      * Return: void
      * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Start screen rendered to plotter
+     * Post-condition: Damaged regions of start screen repainted
      */
     void draw(SDL_Plotter& g) override;
 
@@ -106,6 +122,14 @@ public:
      * Post-condition: infiniteMode updated
      */
     void setInfiniteMode(bool enable);
+
+    /*
+     * Description: Set night race display
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Night label shown or hidden
+     */
+    void setNightMode(bool enable);
 };
 
 // INSTRUCTIONS SCREEN
@@ -134,7 +158,7 @@ public:
      * Description: Draw instructions screen with controls guide
      * Return: void
      * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Instructions screen rendered to plotter
+     * Post-condition: Damaged regions of instructions screen repainted
      */
     void draw(SDL_Plotter& g) override;
 
@@ -170,7 +194,7 @@ public:
      * Description: Draw pause screen with message and options
      * Return: void
      * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Pause screen rendered to plotter
+     * Post-condition: Damaged regions of pause screen repainted
      */
     void draw(SDL_Plotter& g) override;
 
@@ -189,6 +213,8 @@ private:
     int currentLap;      // Current lap count
     int maxLaps;         // Maximum laps (3 for normal, -1 for infinite)
     bool infiniteMode;   // Infinite mode flag
+    NumberRun scoreRun;  // HUD score digits
+    NumberRun speedRun;  // HUD speed digits
 
 public:
     /*
@@ -199,6 +225,23 @@ public:
      */
     PlayingScreen(bool infinite = false);
 
+    /*
+     * Description: Start a new race on this screen without rebuilding it
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Same state as PlayingScreen(infinite); HUD caches kept
+     */
+    void restart(bool infinite);
+
+    /*
+     * Description: Save or restore the lap, mode and flash timer
+     * Return: void
+     * Pre-condition: in holds what saveState wrote
+     * Post-condition: Fields written to out, or read back from in
+     */
+    void saveState(StateWriter& out) const;
+    void loadState(StateReader& in);
+
     /*
      * Description: Update playing screen animations
      * Return: void
@@ -254,6 +297,14 @@ public:
      * Post-condition: Win condition checked
      */
     bool isWinCondition() const;
+
+    /*
+     * Description: Get the lap the player is on
+     * Return: int - current lap, starting at 1
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getLap() const { return currentLap; }
 };
 
 // GAME OVER SCREEN
@@ -261,6 +312,9 @@ class GameOverScreen : public Screen {
 private:
     bool hitAI;        // Whether collision was with AI
     bool hitObstacle;  // Whether collision was with obstacle
+    int  scoreLabel;   // UI node showing final score
+    int  aiLabel;      // UI node for "Hit AI Car!"
+    int  obstacleLabel; // UI node for "Hit Obstacle!"
 
 public:
     /*
@@ -291,7 +345,7 @@ public:
      * Description: Draw game over screen with score and collision info
      * Return: void
      * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Game over screen rendered to plotter
+     * Post-condition: Damaged regions of game over screen repainted
      */
     void draw(SDL_Plotter& g) override;
 
@@ -306,6 +360,9 @@ public:
 
 // WIN SCREEN
 class WinScreen : public Screen {
+private:
+    int scoreLabel;    // UI node showing final score
+
 public:
     /*
      * Description: Initialize win screen
@@ -335,7 +392,7 @@ public:
      * Description: Draw win screen with victory message and score
      * Return: void
      * Pre-condition: SDL_Plotter g is initialized
-     * Post-condition: Win screen rendered to plotter
+     * Post-condition: Damaged regions of win screen repainted
      */
     void draw(SDL_Plotter& g) override;
 
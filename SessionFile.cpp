@@ -0,0 +1,171 @@
+//================================================================
+// SessionFile.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Seekable Session File Implementation
+// Description: File mapping (POSIX mmap, Win32 file mapping), index
+//              reading, and keyframe seeking
+//================================================================
+
+#include "SessionFile.h"
+#include <algorithm>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SessionFile::SessionFile()
+    : data{nullptr},
+      size{0},
+#ifdef _WIN32
+      fileHandle{INVALID_HANDLE_VALUE},
+      mapHandle{nullptr},
+#else
+      fd{-1},
+#endif
+      seed{0},
+      flags{0},
+      tickCount{0},
+      indexed{false}
+{}
+
+SessionFile::~SessionFile() {
+    close();
+}
+
+// MAPPING
+bool SessionFile::open(const std::string& path) {
+    close();
+#ifdef _WIN32
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER length;
+    if(fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &length) || length.QuadPart == 0) {
+        close();
+        return false;
+    }
+    mapHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(mapHandle) data = static_cast<const Uint8*>(MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0));
+    size = static_cast<size_t>(length.QuadPart);
+#else
+    fd = ::open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if(fd < 0 || fstat(fd, &info) != 0 || info.st_size == 0) {
+        close();
+        return false;
+    }
+    size = static_cast<size_t>(info.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(mapped != MAP_FAILED) data = static_cast<const Uint8*>(mapped);
+#endif
+    if(!data || !SessionLog::readHeader(data, size, seed, flags)) {
+        close();
+        return false;
+    }
+
+    // INDEX - at the end of every finished recording
+    uint32_t ticks = 0;
+    indexed = SessionLog::readIndex(data, size, keyframes, ticks) && ticks <= SESSION_MAX_TICKS;
+    if(indexed) tickCount = static_cast<int>(ticks);
+    else scan();
+    return true;
+}
+
+void SessionFile::close() {
+#ifdef _WIN32
+    if(data) UnmapViewOfFile(data);
+    if(mapHandle) CloseHandle(mapHandle);
+    if(fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+    mapHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if(data) munmap(const_cast<Uint8*>(data), size);
+    if(fd >= 0) ::close(fd);
+    fd = -1;
+#endif
+    data = nullptr;
+    size = 0;
+    tickCount = 0;
+    indexed = false;
+    keyframes.clear();
+}
+
+void SessionFile::scan() {
+    const Uint8* pos = data + SESSION_HEADER_BYTES;
+    const Uint8* end = data + size;
+    uint64_t ticks = 0;
+    keyframes.clear();
+
+    while(pos < end) {
+        const Uint8* record = pos;
+        Uint8 code;
+        uint64_t count;
+        if(!SessionLog::getRecord(pos, end, code, count)) break;
+        if(code == SESSION_RECORD_KEYFRAME || code == SESSION_RECORD_INDEX) {
+            if(count > static_cast<uint64_t>(end - pos)) break;
+            if(code == SESSION_RECORD_KEYFRAME && count >= 4) {
+                SessionKeyframe k = { static_cast<uint32_t>(SessionLog::getBytes(pos, 4)),
+                                      static_cast<uint64_t>(record - data) };
+                keyframes.push_back(k);
+            }
+            pos += count;
+            continue;
+        }
+        if(count == 0 || count > SESSION_MAX_TICKS - ticks) break;
+        ticks += count;
+    }
+    tickCount = static_cast<int>(ticks);
+}
+
+// SEEKING
+bool SessionFile::seek(int tick, Simulation& sim) const {
+    if(!data || tick < 0 || tick > tickCount) return false;
+    const Uint8* end = data + size;
+    const Uint8* pos = data + SESSION_HEADER_BYTES;
+    int at = 0;
+
+    // NEAREST KEYFRAME AT OR BEFORE tick - an unreadable one falls back to the one before
+    SessionKeyframe target = { static_cast<uint32_t>(tick), 0 };
+    auto k = std::upper_bound(keyframes.begin(), keyframes.end(), target,
+                              [](const SessionKeyframe& a, const SessionKeyframe& b) { return a.tick < b.tick; });
+    bool restored = false;
+    while(k != keyframes.begin() && !restored) {
+        --k;
+        const Uint8* record = data + k->offset;
+        Uint8 code;
+        uint64_t count;
+        if(!SessionLog::getRecord(record, end, code, count) || code != SESSION_RECORD_KEYFRAME ||
+           count < 4 || count > static_cast<uint64_t>(end - record) ||
+           SessionLog::getBytes(record, 4) != k->tick) {
+            continue;
+        }
+        restored = sim.loadState(record + 4, static_cast<size_t>(count - 4)) &&
+                   sim.getTick() == static_cast<int>(k->tick) && sim.getSeed() == seed;
+        if(restored) {
+            pos = record + count;
+            at = static_cast<int>(k->tick);
+        }
+    }
+    if(!restored) sim.reset(seed, false);
+
+    // RE-SIMULATE THE REST FROM THE INPUT RUNS
+    while(at < tick) {
+        Uint8 code;
+        uint64_t count;
+        if(pos >= end || !SessionLog::getRecord(pos, end, code, count)) return false;
+        if(code == SESSION_RECORD_KEYFRAME || code == SESSION_RECORD_INDEX) {
+            if(count > static_cast<uint64_t>(end - pos)) return false;
+            pos += count;
+            continue;
+        }
+        int steps = static_cast<int>(std::min<uint64_t>(count, static_cast<uint64_t>(tick - at)));
+        for(int s = 0; s < steps; s++) sim.step(code);
+        at += steps;
+    }
+    return true;
+}
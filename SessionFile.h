@@ -0,0 +1,104 @@
+//================================================================
+// SessionFile.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Seekable Session File
+// Description: Memory-mapped session file; seeking restores the nearest
+//              keyframe and re-simulates only the ticks after it
+//================================================================
+
+#ifndef SessionFile_h
+#define SessionFile_h
+
+#include "SessionLog.h"
+#include "Simulation.h"
+#include <string>
+#include <vector>
+
+class SessionFile {
+private:
+    const Uint8*                 data;        // Mapped file, nullptr when closed
+    size_t                       size;
+#ifdef _WIN32
+    void*                        fileHandle;  // HANDLE of the open file
+    void*                        mapHandle;   // HANDLE of its mapping
+#else
+    int                          fd;
+#endif
+    uint64_t                     seed;
+    Uint8                        flags;
+    int                          tickCount;
+    bool                         indexed;     // Keyframes came from the file's index
+    std::vector<SessionKeyframe> keyframes;   // In tick order
+
+    /*
+     * Description: Walk every record of a file with no index (cut short)
+     * Return: void
+     * Pre-condition: File mapped, header checked
+     * Post-condition: tickCount and keyframes cover every complete record
+     */
+    void scan();
+
+public:
+    /*
+     * Description: Create a closed file
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Nothing mapped
+     */
+    SessionFile();
+
+    /*
+     * Description: Unmap the file
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: Mapping and file released
+     */
+    ~SessionFile();
+
+    SessionFile(const SessionFile&) = delete;
+    SessionFile& operator=(const SessionFile&) = delete;
+
+    /*
+     * Description: Map a session file and read its index
+     * Return: bool - true if the file is a session of this version
+     * Pre-condition: path is readable
+     * Post-condition: Previous file closed; a file without an index (its
+     *                 race was cut short) is scanned instead
+     */
+    bool open(const std::string& path);
+
+    /*
+     * Description: Release the mapping
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Nothing mapped
+     */
+    void close();
+
+    /*
+     * Description: Put a race at any tick of the recording
+     * Return: bool - false if tick is out of range or the file is damaged
+     *         before it
+     * Pre-condition: File open
+     * Post-condition: sim is exactly the recorded race after tick ticks:
+     *                 restored from the last keyframe at or before tick
+     *                 (or reset from the seed) and stepped the rest of the
+     *                 way, at most KEYFRAME_INTERVAL ticks
+     */
+    bool seek(int tick, Simulation& sim) const;
+
+    /*
+     * Description: Read-only access
+     * Return: Requested value
+     * Pre-condition: File open
+     * Post-condition: No state change
+     */
+    uint64_t getSeed() const { return seed; }
+    Uint8 getFlags() const { return flags; }
+    int getTickCount() const { return tickCount; }
+    int getKeyframeCount() const { return static_cast<int>(keyframes.size()); }
+    bool isIndexed() const { return indexed; }
+    size_t getSize() const { return size; }
+};
+
+#endif /* SessionFile_h */
@@ -0,0 +1,174 @@
+//================================================================
+// SessionLog.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Session Log Implementation
+// Description: Little-endian header, varint run-length inputs, state
+//              keyframes and keyframe index for recorded races
+//================================================================
+
+#include "SessionLog.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+// FILE LAYOUT: "PRSN", version u32, seed u64, flags u8, then records to
+// the end of the file, so a file can be streamed. Each record starts with
+// one varint (n << SESSION_INPUT_BITS | code):
+//   input code          n ticks of that input
+//   KEYFRAME            n bytes: tick u32, Simulation::saveState()
+//   INDEX (last)        n bytes: (tick u32, record offset u64) per
+//                       keyframe, ticks u32, keyframes u32, "PRSX"
+static const char SESSION_MAGIC[4] = { 'P', 'R', 'S', 'N' };
+static const char SESSION_INDEX_MAGIC[4] = { 'P', 'R', 'S', 'X' };
+static const uint32_t SESSION_VERSION = 10;   // Bumped when the layout or the simulation changes
+
+static void putBytes(std::vector<Uint8>& out, uint64_t value, int bytes) {
+    for(int i = 0; i < bytes; i++) out.push_back(static_cast<Uint8>(value >> (8 * i)));
+}
+
+uint64_t SessionLog::getBytes(const Uint8* in, int bytes) {
+    uint64_t value = 0;
+    for(int i = 0; i < bytes; i++) value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    return value;
+}
+
+void SessionLog::begin(uint64_t raceSeed, Uint8 sessionFlags) {
+    seed = raceSeed;
+    flags = sessionFlags;
+    runStart.clear();
+    runInput.clear();
+    tickCount = 0;
+}
+
+void SessionLog::addRun(Uint8 input, int count) {
+    if(runInput.empty() || runInput.back() != input) {
+        runStart.push_back(tickCount);
+        runInput.push_back(input);
+    }
+    tickCount += count;
+}
+
+// RUN OF A TICK - the last run starting at or before it
+Uint8 SessionLog::getInput(int tick) const {
+    size_t run = std::upper_bound(runStart.begin(), runStart.end(), tick) - runStart.begin();
+    return runInput[run - 1];
+}
+
+void SessionLog::putHeader(std::vector<Uint8>& out, uint64_t raceSeed, Uint8 sessionFlags) {
+    out.insert(out.end(), SESSION_MAGIC, SESSION_MAGIC + 4);
+    putBytes(out, SESSION_VERSION, 4);
+    putBytes(out, raceSeed, 8);
+    putBytes(out, sessionFlags, 1);
+}
+
+// VARINT - seven bits per byte, low first, high bit set on all but the last
+void SessionLog::putRun(std::vector<Uint8>& out, Uint8 input, uint64_t count) {
+    uint64_t value = (count << SESSION_INPUT_BITS) | input;
+    while(value >= 0x80) {
+        out.push_back(static_cast<Uint8>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<Uint8>(value));
+}
+
+void SessionLog::putKeyframe(std::vector<Uint8>& out, uint32_t tick, const std::vector<Uint8>& state) {
+    putRun(out, SESSION_RECORD_KEYFRAME, 4 + state.size());
+    putBytes(out, tick, 4);
+    out.insert(out.end(), state.begin(), state.end());
+}
+
+void SessionLog::putIndex(std::vector<Uint8>& out, const std::vector<SessionKeyframe>& keyframes, uint32_t ticks) {
+    putRun(out, SESSION_RECORD_INDEX, keyframes.size() * SESSION_INDEX_ENTRY_BYTES + SESSION_INDEX_TRAILER_BYTES);
+    for(const SessionKeyframe& k : keyframes) {
+        putBytes(out, k.tick, 4);
+        putBytes(out, k.offset, 8);
+    }
+    putBytes(out, ticks, 4);
+    putBytes(out, keyframes.size(), 4);
+    out.insert(out.end(), SESSION_INDEX_MAGIC, SESSION_INDEX_MAGIC + 4);
+}
+
+bool SessionLog::readHeader(const Uint8* data, size_t size, uint64_t& raceSeed, Uint8& sessionFlags) {
+    if(size < static_cast<size_t>(SESSION_HEADER_BYTES) || std::memcmp(data, SESSION_MAGIC, 4) != 0 ||
+       getBytes(data + 4, 4) != SESSION_VERSION) {
+        return false;
+    }
+    raceSeed = getBytes(data + 8, 8);
+    sessionFlags = data[16];
+    return true;
+}
+
+bool SessionLog::readIndex(const Uint8* data, size_t size, std::vector<SessionKeyframe>& keyframes, uint32_t& ticks) {
+    const size_t minimum = SESSION_HEADER_BYTES + SESSION_INDEX_TRAILER_BYTES;
+    if(size < minimum || std::memcmp(data + size - 4, SESSION_INDEX_MAGIC, 4) != 0) return false;
+
+    uint64_t count = getBytes(data + size - 8, 4);
+    if(count > (size - minimum) / SESSION_INDEX_ENTRY_BYTES) return false;
+    ticks = static_cast<uint32_t>(getBytes(data + size - 12, 4));
+
+    const Uint8* entry = data + size - SESSION_INDEX_TRAILER_BYTES - count * SESSION_INDEX_ENTRY_BYTES;
+    keyframes.resize(static_cast<size_t>(count));
+    for(SessionKeyframe& k : keyframes) {
+        k.tick = static_cast<uint32_t>(getBytes(entry, 4));
+        k.offset = getBytes(entry + 4, 8);
+        entry += SESSION_INDEX_ENTRY_BYTES;
+        if(k.offset < static_cast<uint64_t>(SESSION_HEADER_BYTES) || k.offset >= size) return false;
+    }
+    return true;
+}
+
+bool SessionLog::getRecord(const Uint8*& pos, const Uint8* end, Uint8& code, uint64_t& count) {
+    uint64_t value = 0;
+    for(int shift = 0; pos < end && shift <= 56; shift += 7) {
+        Uint8 byte = *pos++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if(!(byte & 0x80)) {
+            code = static_cast<Uint8>(value & ((1 << SESSION_INPUT_BITS) - 1));
+            count = value >> SESSION_INPUT_BITS;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SessionLog::save(const std::string& path) const {
+    std::vector<Uint8> data;
+    putHeader(data, seed, flags);
+    for(size_t run = 0; run < runStart.size(); run++) {
+        int end = run + 1 < runStart.size() ? runStart[run + 1] : tickCount;
+        putRun(data, runInput[run], static_cast<uint64_t>(end - runStart[run]));
+    }
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if(!file) return false;
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    return std::fclose(file) == 0 && ok;
+}
+
+bool SessionLog::load(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if(!file) return false;
+    std::vector<Uint8> data;
+    Uint8 block[4096];
+    for(size_t got; (got = std::fread(block, 1, sizeof(block), file)) > 0; ) data.insert(data.end(), block, block + got);
+    std::fclose(file);
+
+    if(!readHeader(data.data(), data.size(), seed, flags)) return false;
+
+    // RECORDS - one cut off by an interrupted write ends the log
+    begin(seed, flags);
+    const Uint8* pos = data.data() + SESSION_HEADER_BYTES;
+    const Uint8* end = data.data() + data.size();
+    Uint8 code;
+    uint64_t count;
+    while(pos < end && getRecord(pos, end, code, count)) {
+        if(code == SESSION_RECORD_KEYFRAME || code == SESSION_RECORD_INDEX) {
+            if(count > static_cast<uint64_t>(end - pos)) break;
+            pos += count;
+            continue;
+        }
+        if(count == 0 || count > SESSION_MAX_TICKS - static_cast<size_t>(tickCount)) return false;
+        addRun(code, static_cast<int>(count));
+    }
+    return true;
+}
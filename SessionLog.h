@@ -0,0 +1,166 @@
+//================================================================
+// SessionLog.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Session Log
+// Description: Seed and per-tick inputs of one race, enough to
+//              re-simulate it exactly, and the session file encoding:
+//              varint input runs, state keyframes and a keyframe index
+//================================================================
+
+#ifndef SessionLog_h
+#define SessionLog_h
+
+#include "Const.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// SESSION FLAGS
+const Uint8 SESSION_NIGHT = 0x01;
+
+// FILE ENCODING
+const int SESSION_HEADER_BYTES = 17;   // Magic, version, seed, flags
+const int SESSION_INPUT_BITS = 5;      // makeTickInput() values fit in 5 bits
+const size_t SESSION_MAX_TICKS = 0x7FFFFFFF;   // getTickCount() is an int
+const Uint8 SESSION_RECORD_INDEX = 0x1E;       // Record code: keyframe index, to the end of the file
+const Uint8 SESSION_RECORD_KEYFRAME = 0x1F;    // Record code: tick and saved race state
+const int SESSION_INDEX_ENTRY_BYTES = 12;      // Tick u32, record offset u64
+const int SESSION_INDEX_TRAILER_BYTES = 12;    // Ticks u32, keyframes u32, magic
+
+// ONE ENTRY OF THE KEYFRAME INDEX
+struct SessionKeyframe {
+    uint32_t tick;     // Ticks simulated when the state was saved
+    uint64_t offset;   // File offset of the keyframe record
+};
+
+class SessionLog {
+private:
+    uint64_t           seed;        // Simulation seed
+    Uint8              flags;       // SESSION_* bits
+    std::vector<int>   runStart;    // First tick of each run of identical inputs, ascending
+    std::vector<Uint8> runInput;    // makeTickInput() value held through each run
+    int                tickCount;   // Ticks recorded
+
+    /*
+     * Description: Append count ticks of one input
+     * Return: void
+     * Pre-condition: count > 0, tickCount + count <= SESSION_MAX_TICKS
+     * Post-condition: Joined onto the last run if it holds the same input
+     */
+    void addRun(Uint8 input, int count);
+
+public:
+    /*
+     * Description: Create an empty log
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: No ticks recorded
+     */
+    SessionLog() : seed{0}, flags{0}, tickCount{0} {}
+
+    /*
+     * Description: Start recording a new race
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Previous ticks dropped
+     */
+    void begin(uint64_t raceSeed, Uint8 sessionFlags);
+
+    /*
+     * Description: Change the session flags (e.g. night toggled before racing)
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: flags updated
+     */
+    void setFlags(Uint8 sessionFlags) { flags = sessionFlags; }
+
+    /*
+     * Description: Append one tick's input
+     * Return: void
+     * Pre-condition: begin() called
+     * Post-condition: getTickCount() incremented; memory grows per change
+     *                 of input, not per tick
+     */
+    void record(Uint8 input) { addRun(input, 1); }
+
+    /*
+     * Description: Write or read the log file
+     * Return: bool - true on success
+     * Pre-condition: path is writable / readable
+     * Post-condition: File holds (or log holds) seed, flags, and inputs;
+     *                 load keeps every complete run of a file cut short,
+     *                 holding runs as they are stored, so a long run
+     *                 costs no more memory than a short one
+     */
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    /*
+     * Description: Append the file header, or one run of identical inputs
+     *              as a single varint (count << SESSION_INPUT_BITS | input)
+     * Return: void
+     * Pre-condition: input < (1 << SESSION_INPUT_BITS); count > 0
+     * Post-condition: Encoded bytes appended to out
+     */
+    static void putHeader(std::vector<Uint8>& out, uint64_t raceSeed, Uint8 sessionFlags);
+    static void putRun(std::vector<Uint8>& out, Uint8 input, uint64_t count);
+
+    /*
+     * Description: Append a keyframe record (the race state after tick
+     *              ticks), or the index record that ends a file
+     * Return: void
+     * Pre-condition: keyframe offsets are where their records start
+     * Post-condition: Record appended to out
+     */
+    static void putKeyframe(std::vector<Uint8>& out, uint32_t tick, const std::vector<Uint8>& state);
+    static void putIndex(std::vector<Uint8>& out, const std::vector<SessionKeyframe>& keyframes, uint32_t ticks);
+
+    /*
+     * Description: Decode the varint that starts a record
+     * Return: bool - false if the varint runs past end or is too long
+     * Pre-condition: pos < end
+     * Post-condition: pos moved past the varint; code is the input (or
+     *                 SESSION_RECORD_*), count the ticks (or payload bytes)
+     */
+    static bool getRecord(const Uint8*& pos, const Uint8* end, Uint8& code, uint64_t& count);
+
+    /*
+     * Description: Check a file's header, or read the index that ends it
+     * Return: bool - false if the header is not this version's, or the
+     *         file does not end in a complete index
+     * Pre-condition: data holds the whole file (size bytes)
+     * Post-condition: seed and flags, or keyframes (in tick order) and
+     *                 the total tick count, filled in
+     */
+    static bool readHeader(const Uint8* data, size_t size, uint64_t& raceSeed, Uint8& sessionFlags);
+    static bool readIndex(const Uint8* data, size_t size, std::vector<SessionKeyframe>& keyframes, uint32_t& ticks);
+
+    /*
+     * Description: Read a little-endian field of a file
+     * Return: uint64_t - the value
+     * Pre-condition: in holds bytes bytes
+     * Post-condition: No state change
+     */
+    static uint64_t getBytes(const Uint8* in, int bytes);
+
+    /*
+     * Description: Input of one tick
+     * Return: Uint8 - makeTickInput() value
+     * Pre-condition: 0 <= tick < getTickCount()
+     * Post-condition: No state change; O(log runs) binary search, safe
+     *                 from several threads at once
+     */
+    Uint8 getInput(int tick) const;
+
+    /*
+     * Description: Read-only access
+     * Return: Requested value
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    uint64_t getSeed() const { return seed; }
+    Uint8 getFlags() const { return flags; }
+    int getTickCount() const { return tickCount; }
+};
+
+#endif /* SessionLog_h */
@@ -0,0 +1,133 @@
+//================================================================
+// SessionWriter.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Background Session Writer Implementation
+// Description: Run counting on the game thread; file open, write,
+//              flush, and close on the writer thread
+//================================================================
+
+#include "SessionWriter.h"
+#include <chrono>
+
+SessionWriter::SessionWriter()
+    : recording{false},
+      runInput{0},
+      runLength{0},
+      ticks{0},
+      streamBytes{0},
+      closing{false},
+      stopping{false},
+      failed{false},
+      file{nullptr}
+{
+    writer = std::thread(&SessionWriter::writerLoop, this);
+}
+
+SessionWriter::~SessionWriter() {
+    finish();
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+    if(file) std::fclose(file);
+}
+
+// GAME THREAD
+void SessionWriter::begin(const std::string& path, uint64_t raceSeed, Uint8 sessionFlags) {
+    finish();
+    recording = true;
+    runLength = 0;
+    ticks = 0;
+    keyframes.clear();
+
+    std::lock_guard<std::mutex> guard(lock);
+    openPath = path;
+    SessionLog::putHeader(queued, raceSeed, sessionFlags);
+    streamBytes = queued.size();
+    failed = false;
+}
+
+void SessionWriter::record(Uint8 input) {
+    if(!recording) return;
+    if(runLength > 0 && (input != runInput || runLength >= static_cast<uint64_t>(SESSION_RUN_SPLIT_TICKS))) {
+        queueRun();
+    }
+    runInput = input;
+    runLength++;
+    ticks++;
+}
+
+void SessionWriter::addKeyframe(const std::vector<Uint8>& state) {
+    if(!recording) return;
+    if(runLength > 0) queueRun();
+
+    std::lock_guard<std::mutex> guard(lock);
+    SessionKeyframe k = { static_cast<uint32_t>(ticks), streamBytes };
+    keyframes.push_back(k);
+    size_t before = queued.size();
+    SessionLog::putKeyframe(queued, k.tick, state);
+    streamBytes += queued.size() - before;
+}
+
+void SessionWriter::queueRun() {
+    std::lock_guard<std::mutex> guard(lock);
+    size_t before = queued.size();
+    SessionLog::putRun(queued, runInput, runLength);
+    streamBytes += queued.size() - before;
+    runLength = 0;
+}
+
+bool SessionWriter::finish() {
+    if(!recording) return true;
+    if(runLength > 0) queueRun();
+    recording = false;
+
+    std::unique_lock<std::mutex> guard(lock);
+    SessionLog::putIndex(queued, keyframes, static_cast<uint32_t>(ticks));
+    closing = true;
+    wake.notify_one();
+    idle.wait(guard, [this] { return !closing; });
+    return !failed;
+}
+
+// WRITER THREAD - take everything queued, write it outside the lock
+void SessionWriter::writerLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+    for(;;) {
+        wake.wait_for(guard, std::chrono::milliseconds(SESSION_FLUSH_MS), [this] { return stopping || closing; });
+        if(queued.empty() && openPath.empty() && !closing) {
+            if(stopping) return;
+            continue;
+        }
+
+        std::string path;
+        path.swap(openPath);
+        writing.swap(queued);
+        bool close = closing;
+        guard.unlock();
+
+        bool ok = true;
+        if(!path.empty()) {
+            if(file) std::fclose(file);
+            file = std::fopen(path.c_str(), "wb");
+        }
+        if(!writing.empty()) {
+            ok = file && std::fwrite(writing.data(), 1, writing.size(), file) == writing.size() &&
+                 std::fflush(file) == 0;
+            writing.clear();
+        }
+        if(close && file) {
+            ok = std::fclose(file) == 0 && ok;
+            file = nullptr;
+        }
+
+        guard.lock();
+        if(!ok) failed = true;
+        if(close) {
+            closing = false;
+            idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,122 @@
+//================================================================
+// SessionWriter.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Background Session Writer
+// Description: Streams the race being played to a session file from a
+//              writer thread, so a recording survives a crash or quit
+//              and the game thread only run-length counts its inputs
+//================================================================
+
+#ifndef SessionWriter_h
+#define SessionWriter_h
+
+#include "SessionLog.h"
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+class SessionWriter {
+private:
+    // GAME THREAD ONLY
+    bool                         recording;     // begin() called, finish() not yet
+    Uint8                        runInput;      // Input of the run being counted
+    uint64_t                     runLength;     // Ticks in that run (0 = none yet)
+    uint64_t                     ticks;         // Ticks recorded this race
+    uint64_t                     streamBytes;   // Bytes queued since begin() (the next record's offset)
+    std::vector<SessionKeyframe> keyframes;     // Index written by finish()
+
+    // SHARED, GUARDED BY lock
+    std::mutex              lock;
+    std::condition_variable wake;          // Writer has work (or should stop)
+    std::condition_variable idle;          // Writer finished a close
+    std::string             openPath;      // File to start before writing queued
+    std::vector<Uint8>      queued;        // Encoded bytes not yet written
+    bool                    closing;       // Close the file once queued is written
+    bool                    stopping;
+    bool                    failed;        // A write or open failed this race
+
+    // WRITER THREAD ONLY
+    FILE*                   file;
+    std::vector<Uint8>      writing;       // Bytes being written, swapped with queued
+
+    std::thread             writer;
+
+    /*
+     * Description: Writer thread body
+     * Return: void
+     * Pre-condition: Started by the constructor
+     * Post-condition: Returns once stopping is set and all work is written
+     */
+    void writerLoop();
+
+    /*
+     * Description: Hand the run being counted to the writer
+     * Return: void
+     * Pre-condition: runLength > 0
+     * Post-condition: Run encoded into queued; runLength = 0
+     */
+    void queueRun();
+
+public:
+    /*
+     * Description: Start the writer thread
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Not recording
+     */
+    SessionWriter();
+
+    /*
+     * Description: Write what is left and stop the writer thread
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: Any open recording finished and closed
+     */
+    ~SessionWriter();
+
+    /*
+     * Description: Start recording a race to path (replacing the file)
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Previous recording finished; header queued
+     */
+    void begin(const std::string& path, uint64_t raceSeed, Uint8 sessionFlags);
+
+    /*
+     * Description: Count one tick's input
+     * Return: void
+     * Pre-condition: None (ignored when not recording)
+     * Post-condition: A run that ended (or reached SESSION_RUN_SPLIT_TICKS)
+     *                 is queued; the writer writes it within SESSION_FLUSH_MS
+     */
+    void record(Uint8 input);
+
+    /*
+     * Description: Store the race state at this point of the recording
+     * Return: void
+     * Pre-condition: state from Simulation::saveState after
+     *                getTickCount() ticks
+     * Post-condition: Keyframe record queued and added to the index
+     */
+    void addKeyframe(const std::vector<Uint8>& state);
+
+    /*
+     * Description: End the recording and wait until it is on disk
+     * Return: bool - true if every byte was written
+     * Pre-condition: None
+     * Post-condition: Keyframe index written; file closed; not recording
+     */
+    bool finish();
+
+    /*
+     * Description: Recording state
+     * Return: bool - true between begin() and finish(); uint64_t - ticks since begin()
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool isRecording() const { return recording; }
+    uint64_t getTickCount() const { return ticks; }
+};
+
+#endif /* SessionWriter_h */
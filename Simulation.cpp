@@ -0,0 +1,186 @@
+//================================================================
+// Simulation.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Race Simulation Implementation
+// Description: Race reset, the per-tick update, and world drawing
+//================================================================
+
+#include "Simulation.h"
+#include "Collision.h"
+#include "StateStream.h"
+#include <algorithm>
+
+Uint8 makeTickInput(char key, bool infiniteMode) {
+    Uint8 input = 0;
+    if(key == UP_ARROW || key == DOWN_ARROW || key == LEFT_ARROW || key == RIGHT_ARROW) {
+        input = static_cast<Uint8>(key);
+    }
+    return infiniteMode ? (input | INPUT_INFINITE) : input;
+}
+
+Simulation::Simulation(int maxAICars, int maxObstacles)
+    : seed{1},
+      player(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR),
+      entities(maxAICars, maxObstacles),
+      collisionCooldown{0},
+      crashTimer{0},
+      tick{0},
+      infinite{false},
+      jobs{nullptr}
+{
+    reset(1, false);
+}
+
+void Simulation::setJobs(JobSystem* jobSystem) {
+    jobs = jobSystem;
+    entities.setJobs(jobSystem);
+}
+
+void Simulation::reset(uint64_t raceSeed, bool infiniteMode, const RaceParams& raceParams) {
+    seed = raceSeed;
+
+    player = PlayerCar(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR);
+    bg = Background();
+    points.reset();
+    hud.restart(infiniteMode);
+    entities.clear();
+    entities.seed(raceSeed);
+    entities.setParams(raceParams);
+    entities.addAICar(-50,  AI_BLUE,  4 + raceParams.aiSpeedBonus);
+    entities.addAICar(-150, AI_GREEN, 3 + raceParams.aiSpeedBonus);
+    entities.addAICar(-250, AI_YELLOW, 5 + raceParams.aiSpeedBonus);
+    entities.addObstacle(LEFT_LANE_X,   -100, OBSTACLE_SIZE);
+    entities.addObstacle(CENTER_LANE_X, -300, OBSTACLE_SIZE);
+    entities.addObstacle(RIGHT_LANE_X,  -500, OBSTACLE_SIZE);
+    entities.addTraffic(raceParams.startTraffic);
+    collisionCooldown = 0;
+    crashTimer = 0;
+    tick = 0;
+    infinite = infiniteMode;
+}
+
+TickEvents Simulation::step(Uint8 input) {
+    TickEvents events = TickEvents();
+    tick++;
+
+    // CRASH EFFECT - world frozen, input locked
+    if(crashTimer > 0) {
+        events.frozen = true;
+        if(--crashTimer == 0) events.over = true;
+        return events;
+    }
+
+    bool infiniteMode = (input & INPUT_INFINITE) != 0;
+    if(infiniteMode != infinite) {
+        infinite = infiniteMode;
+        hud.setInfiniteMode(infinite);
+    }
+
+    char key = static_cast<char>(input & INPUT_KEY_MASK);
+    player.beginTick();
+    if(key != 0) {
+        player.move(key);
+        events.skid = (key == RIGHT_ARROW || key == LEFT_ARROW || key == DOWN_ARROW);
+    }
+
+    bg.update(player.getSpeed());
+    points.updateSpeed(player.getSpeed());
+    points.update();
+    player.update(bg.getOffset());
+
+    int lap = hud.getLap();
+    hud.update(points);
+    if(hud.getLap() > lap) entities.addTraffic(entities.getParams().trafficPerLap);
+
+    // ENTITY PHASES - after the AI cars decide (reading obstacles where
+    // they stand), the cars and obstacles finish their updates
+    // independently; each phase keeps its own count, applied below in
+    // a fixed order however the phases were scheduled
+    const point playerLoc = player.getLoc();
+    const int playerSpeed = player.getSpeed();
+    int passed = 0, avoided = 0;
+    auto planCars = [&]{ entities.planAICars(playerLoc); };
+    auto finishCars = [&]{ passed = entities.finishAICars(); };
+    auto scrollObstacles = [&]{ avoided = entities.updateObstacles(playerSpeed); };
+    JobGraph phases;
+    int plan = phases.add(planCars);
+    phases.depend(phases.add(finishCars), plan);
+    phases.depend(phases.add(scrollObstacles), plan);
+    const int total = entities.getAICount() + entities.getObstacleCount();
+    phases.run(jobs && total >= jobs->getParallelEntities() ? jobs : nullptr);
+
+    for(int i = 0; i < passed; i++) points.addCarPass();
+    for(int i = 0; i < avoided; i++) points.addObstacleAvoided();
+
+    if(collisionCooldown <= 0) {
+        bool hitAI = false, hitObstacle = false;
+        point contact;
+        Collision::checkAllCollisions(player, entities, hitAI, hitObstacle, contact);
+
+        if(hitAI || hitObstacle) {
+            player.setSpeed(std::max(MIN_SPEED, player.getSpeed() - COLLISION_SPEED_PENALTY));
+            events.crashed = true;
+            events.hitAI = hitAI;
+            events.hitObstacle = hitObstacle;
+            events.contact = contact;
+            events.crashScore = std::max(0, points.getScore() - COLLISION_POINTS_PENALTY);
+            crashTimer = CRASH_EFFECT_FRAMES;
+        }
+    } else {
+        collisionCooldown--;
+    }
+
+    if(hud.isWinCondition()) {
+        crashTimer = 0;
+        events.won = true;
+    }
+    return events;
+}
+
+// SAVED STATE
+void Simulation::saveState(std::vector<Uint8>& out) const {
+    StateWriter writer(out);
+    writer.put(seed);
+    writer.put(collisionCooldown);
+    writer.put(crashTimer);
+    writer.put(tick);
+    writer.put(infinite);
+    player.saveState(writer);
+    bg.saveState(writer);
+    points.saveState(writer);
+    hud.saveState(writer);
+    entities.saveState(writer);
+}
+
+bool Simulation::loadState(const Uint8* data, size_t size) {
+    StateReader reader(data, size);
+    reader.get(seed);
+    reader.get(collisionCooldown);
+    reader.get(crashTimer);
+    reader.get(tick);
+    reader.get(infinite);
+    player.loadState(reader);
+    bg.loadState(reader);
+    points.loadState(reader);
+    hud.loadState(reader);
+    entities.loadState(reader);
+    return reader.good() && reader.remaining() == 0;
+}
+
+// DRAW
+void Simulation::drawBackground(SDL_Plotter& g) {
+    bg.draw(g);
+}
+
+void Simulation::drawObstacles(SDL_Plotter& g) {
+    for(int i = 0; i < entities.getObstacleCount(); i++) entities.getObstacle(i).draw(g);
+}
+
+void Simulation::drawCars(SDL_Plotter& g) {
+    for(int i = 0; i < entities.getAICount(); i++) entities.getAICar(i).draw(g);
+    player.draw(g);
+}
+
+void Simulation::drawHud(SDL_Plotter& g) {
+    hud.draw(g, points, player);
+}
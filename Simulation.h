@@ -0,0 +1,147 @@
+//================================================================
+// Simulation.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Race Simulation
+// Description: All state of one race, advanced one tick at a time
+//              from a seed and per-tick inputs, with no rendering
+//================================================================
+
+#ifndef Simulation_h
+#define Simulation_h
+
+#include "Const.h"
+#include "Car.h"
+#include "EntityStore.h"
+#include "Background.h"
+#include "Points.h"
+#include "Screen.h"
+#include "Random.h"
+#include "JobSystem.h"
+#include <cstdint>
+
+// PER-TICK INPUT - arrow key code plus the race mode in force
+const Uint8 INPUT_KEY_MASK = 0x0F;
+const Uint8 INPUT_INFINITE = 0x10;
+
+/*
+ * Description: Pack a key press and mode into one tick input
+ * Return: Uint8 - arrow code (0 if none) | INPUT_INFINITE
+ * Pre-condition: None
+ * Post-condition: No state change
+ */
+Uint8 makeTickInput(char key, bool infiniteMode);
+
+// WHAT HAPPENED DURING ONE TICK (drives effects and screen changes)
+struct TickEvents {
+    bool  skid;          // Player steered or braked
+    bool  frozen;        // Crash playing out, world not moving
+    bool  crashed;       // Player hit something this tick
+    bool  hitAI;         // Crash involved an AI car
+    bool  hitObstacle;   // Crash involved an obstacle
+    point contact;       // Crash point
+    int   crashScore;    // Score shown on the game over screen
+    bool  over;          // Crash finished, race lost
+    bool  won;           // Final lap reached
+};
+
+class Simulation {
+private:
+    uint64_t              seed;              // Seed the race started from
+    PlayerCar             player;
+    Background            bg;
+    PointsManager         points;
+    PlayingScreen         hud;               // Lap tracking and HUD runs
+    EntityStore           entities;          // AI cars and obstacles
+    int                   collisionCooldown;
+    int                   crashTimer;        // Frames of crash effect left
+    int                   tick;              // Ticks simulated since reset
+    bool                  infinite;          // Infinite mode in force
+    JobSystem*            jobs;              // Runs the update phases, null for this thread only
+
+public:
+    /*
+     * Description: Create a race from seed 1 in normal mode
+     * Return: None (constructor)
+     * Pre-condition: maxAICars >= 0, maxObstacles >= 0
+     * Post-condition: Same as reset(1, false); entity pools of the given
+     *                 capacities
+     */
+    explicit Simulation(int maxAICars = MAX_AI_CARS, int maxObstacles = MAX_OBSTACLES);
+
+    /*
+     * Description: Run the update phases of each tick on a job system
+     * Return: void
+     * Pre-condition: jobSystem outlives the race, or is null
+     * Post-condition: Once cars have decided their lanes, the AI car and
+     *                 obstacle updates run as a job graph, each splitting
+     *                 its entity loops across the threads; states and
+     *                 events match a null jobSystem tick for tick
+     */
+    void setJobs(JobSystem* jobSystem);
+
+    /*
+     * Description: Start a new race
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Every car, obstacle, score, and timer back to the
+     *                 start; AI and spawns tuned by raceParams, with
+     *                 raceParams.startTraffic extra entities placed
+     */
+    void reset(uint64_t raceSeed, bool infiniteMode, const RaceParams& raceParams = RaceParams());
+
+    /*
+     * Description: Apply one tick of input and advance the race
+     * Return: TickEvents - what happened this tick
+     * Pre-condition: input from makeTickInput
+     * Post-condition: tick incremented; identical inputs from the same
+     *                 seed give identical states
+     */
+    TickEvents step(Uint8 input);
+
+    /*
+     * Description: Save the whole race state, or restore one
+     * Return: void; bool - true if data held a complete, valid state
+     * Pre-condition: data holds size bytes written by saveState
+     * Post-condition: saveState appends to out; after a successful
+     *                 loadState the race continues exactly as the saved
+     *                 one would; after a failed one, reset before stepping
+     */
+    void saveState(std::vector<Uint8>& out) const;
+    bool loadState(const Uint8* data, size_t size);
+
+    /*
+     * Description: Draw the road, obstacles, and cars
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: World layer rendered (no effects or HUD)
+     */
+    void drawBackground(SDL_Plotter& g);
+    void drawObstacles(SDL_Plotter& g);
+    void drawCars(SDL_Plotter& g);
+
+    /*
+     * Description: Draw score, speed, and lap display
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: HUD rendered
+     */
+    void drawHud(SDL_Plotter& g);
+
+    /*
+     * Description: Read-only access to race state
+     * Return: Requested value
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    const PlayerCar& getPlayer() const { return player; }
+    const EntityStore& getEntities() const { return entities; }
+    const PointsManager& getPoints() const { return points; }
+    int getScore() const { return points.getScore(); }
+    int getTick() const { return tick; }
+    int getLap() const { return hud.getLap(); }
+    uint64_t getSeed() const { return seed; }
+    bool isCrashing() const { return crashTimer > 0; }
+    bool isInfinite() const { return infinite; }
+};
+
+#endif /* Simulation_h */
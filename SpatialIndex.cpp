@@ -0,0 +1,58 @@
+//================================================================
+// SpatialIndex.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Spatial Index Implementation
+// Description: Counting-sort bucketing and per-bucket y ordering
+//================================================================
+
+#include "SpatialIndex.h"
+#include "JobSystem.h"
+
+SpatialIndex::SpatialIndex(const std::vector<int>& bucketEdges)
+    : edges(bucketEdges),
+      bucketStart(bucketEdges.size() + 2, 0)
+{}
+
+// (y, index) AS ONE UNSIGNED KEY - negative y sorts first
+static uint64_t sortKey(int y, int index) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(y) ^ 0x80000000u) << 32) |
+           static_cast<uint32_t>(index);
+}
+
+void SpatialIndex::build(const int* x, const int* y, int count, JobSystem* jobs) {
+    const int buckets = getBucketCount();
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+    keys.resize(count);
+    entryY.resize(count);
+    entryId.resize(count);
+
+    // COUNTING SORT INTO BUCKETS (entity order kept within each)
+    for(int i = 0; i < count; i++) {
+        entryId[i] = bucketOf(x[i]);
+        bucketStart[entryId[i] + 1]++;
+    }
+    for(int b = 0; b < buckets; b++) bucketStart[b + 1] += bucketStart[b];
+
+    cursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+    for(int i = 0; i < count; i++) keys[cursor[entryId[i]]++] = sortKey(y[i], i);
+
+    // SORT EACH BUCKET BY (y, index), THEN UNPACK
+    parallelFor(jobs, buckets, 1, [&](int begin, int end, int) {
+        for(int b = begin; b < end; b++) {
+            std::sort(keys.begin() + bucketStart[b], keys.begin() + bucketStart[b + 1]);
+        }
+    });
+    parallelFor(jobs, count, [&](int begin, int end, int) {
+        for(int i = begin; i < end; i++) {
+            entryY[i] = static_cast<int>(static_cast<uint32_t>(keys[i] >> 32) ^ 0x80000000u);
+            entryId[i] = static_cast<int>(static_cast<uint32_t>(keys[i]));
+        }
+    });
+}
+
+void SpatialIndex::reserve(int count) {
+    keys.reserve(count);
+    entryY.reserve(count);
+    entryId.reserve(count);
+    cursor.reserve(bucketStart.size());
+}
@@ -0,0 +1,94 @@
+//================================================================
+// SpatialIndex.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Spatial Index
+// Description: Entities bucketed by x (lanes or column bands) and
+//              sorted by y, for nearby-entity queries
+//================================================================
+
+#ifndef SpatialIndex_h
+#define SpatialIndex_h
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+class JobSystem;  // Forward declaration
+
+class SpatialIndex {
+private:
+    std::vector<int>      edges;        // Bucket boundaries in x, ascending
+    std::vector<int>      bucketStart;  // First entry of each bucket, plus end
+    std::vector<int>      entryY;       // Entry y, ascending within each bucket
+    std::vector<int>      entryId;      // Entity index of each entry
+    std::vector<uint64_t> keys;         // Build scratch: (y, index) sort keys
+    std::vector<int>      cursor;       // Build scratch: next slot per bucket
+
+public:
+    /*
+     * Description: Create an index with one bucket per x range
+     * Return: None (constructor)
+     * Pre-condition: bucketEdges ascending; bucket b covers
+     *                [edges[b-1], edges[b]), the ends are open
+     * Post-condition: Empty index with edges.size() + 1 buckets
+     */
+    explicit SpatialIndex(const std::vector<int>& bucketEdges = std::vector<int>());
+
+    /*
+     * Description: Index entities by their center positions
+     * Return: void
+     * Pre-condition: x and y hold count entries; jobs may be null
+     * Post-condition: Every entity in its bucket, sorted by (y, index);
+     *                 with jobs, buckets sort on its threads
+     */
+    void build(const int* x, const int* y, int count, JobSystem* jobs = nullptr);
+
+    /*
+     * Description: Allocate room for up to count entities
+     * Return: void
+     * Pre-condition: count >= 0
+     * Post-condition: build() with at most count entities never allocates
+     */
+    void reserve(int count);
+
+    /*
+     * Description: Bucket holding x
+     * Return: int - bucket index
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int bucketOf(int x) const {
+        return static_cast<int>(std::upper_bound(edges.begin(), edges.end(), x) - edges.begin());
+    }
+
+    /*
+     * Description: Visit entities whose bucket overlaps [x0, x1] and whose
+     *              y lies in [y0, y1]
+     * Return: void
+     * Pre-condition: visit(int index) returns true to stop early
+     * Post-condition: Candidates visited in bucket, then y order; caller
+     *                 applies the exact test
+     */
+    template <typename Visit>
+    void query(int x0, int x1, int y0, int y1, Visit visit) const {
+        int last = bucketOf(x1);
+        for(int b = bucketOf(x0); b <= last; b++) {
+            const int* begin = entryY.data() + bucketStart[b];
+            const int* end = entryY.data() + bucketStart[b + 1];
+            for(const int* e = std::lower_bound(begin, end, y0); e != end && *e <= y1; e++) {
+                if(visit(entryId[e - entryY.data()])) return;
+            }
+        }
+    }
+
+    /*
+     * Description: Get bucket count and entries per bucket
+     * Return: int - requested count
+     * Pre-condition: 0 <= bucket < getBucketCount()
+     * Post-condition: No state change
+     */
+    int getBucketCount() const { return static_cast<int>(edges.size()) + 1; }
+    int getBucketSize(int bucket) const { return bucketStart[bucket + 1] - bucketStart[bucket]; }
+};
+
+#endif /* SpatialIndex_h */
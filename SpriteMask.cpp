@@ -0,0 +1,56 @@
+//================================================================
+// SpriteMask.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Sprite Collision Mask Implementation
+// Description: Mask building and shifted-word overlap tests
+//================================================================
+
+#include "SpriteMask.h"
+#include <algorithm>
+
+const int WORD_BITS = 64;
+
+SpriteMask::SpriteMask(int w, int h)
+    : width{w},
+      height{h},
+      wordsPerRow{(w + WORD_BITS - 1) / WORD_BITS},
+      bits(static_cast<size_t>(wordsPerRow) * h, 0)
+{}
+
+void SpriteMask::fillRect(int x, int y, int w, int h) {
+    int x0 = std::max(x, 0), x1 = std::min(x + w, width);
+    int y0 = std::max(y, 0), y1 = std::min(y + h, height);
+    for(int row = y0; row < y1; row++) {
+        for(int col = x0; col < x1; col++) {
+            bits[row * wordsPerRow + col / WORD_BITS] |= static_cast<uint64_t>(1) << (col % WORD_BITS);
+        }
+    }
+}
+
+bool SpriteMask::get(int x, int y) const {
+    if(x < 0 || x >= width || y < 0 || y >= height) return false;
+    return (bits[y * wordsPerRow + x / WORD_BITS] >> (x % WORD_BITS)) & 1;
+}
+
+uint64_t SpriteMask::rowBits(int y, int x) const {
+    if(x >= width || x <= -WORD_BITS) return 0;
+
+    // WORD INDEX AND BIT SHIFT, ROUNDED TOWARD NEGATIVE INFINITY
+    int w = x >= 0 ? x / WORD_BITS : -((-x + WORD_BITS - 1) / WORD_BITS);
+    int shift = x - w * WORD_BITS;
+    if(shift == 0) return word(y, w);
+    return (word(y, w) >> shift) | (word(y, w + 1) << (WORD_BITS - shift));
+}
+
+bool SpriteMask::overlaps(const SpriteMask& a, int ax, int ay, const SpriteMask& b, int bx, int by) {
+    // ROWS AND COLUMNS BOTH MASKS COVER
+    int top = std::max(ay, by), bottom = std::min(ay + a.height, by + b.height);
+    if(top >= bottom || std::max(ax, bx) >= std::min(ax + a.width, bx + b.width)) return false;
+
+    for(int y = top; y < bottom; y++) {
+        for(int w = 0; w < a.wordsPerRow; w++) {
+            if(a.word(y - ay, w) & b.rowBits(y - by, ax - bx + w * WORD_BITS)) return true;
+        }
+    }
+    return false;
+}
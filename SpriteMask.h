@@ -0,0 +1,84 @@
+//================================================================
+// SpriteMask.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Sprite Collision Mask
+// Description: 1-bit mask of the pixels a sprite covers, packed into
+//              64-bit words per row for word-at-a-time overlap tests
+//================================================================
+
+#ifndef SpriteMask_h
+#define SpriteMask_h
+
+#include <cstdint>
+#include <vector>
+
+class SpriteMask {
+private:
+    int                   width, height;    // Mask size in pixels
+    int                   wordsPerRow;      // 64-bit words per row
+    std::vector<uint64_t> bits;             // Row-major; pixel x is bit x % 64 of word x / 64
+
+    /*
+     * Description: One word of a row
+     * Return: uint64_t - the word, 0 outside the mask
+     * Pre-condition: 0 <= y < height
+     * Post-condition: No state change
+     */
+    uint64_t word(int y, int w) const {
+        return (w < 0 || w >= wordsPerRow) ? 0 : bits[y * wordsPerRow + w];
+    }
+
+public:
+    /*
+     * Description: Create an empty mask
+     * Return: None (constructor)
+     * Pre-condition: w, h >= 0
+     * Post-condition: w x h mask with no pixels set
+     */
+    SpriteMask(int w = 0, int h = 0);
+
+    /*
+     * Description: Set a rectangle of pixels (clipped to the mask)
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Pixels [x, x + w) x [y, y + h) set
+     */
+    void fillRect(int x, int y, int w, int h);
+
+    /*
+     * Description: Check one pixel
+     * Return: bool - true if set, false if clear or outside the mask
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool get(int x, int y) const;
+
+    /*
+     * Description: 64 pixels of a row starting at column x
+     * Return: uint64_t - bit i is pixel x + i; pixels outside the mask are 0
+     * Pre-condition: 0 <= y < height; x may be negative
+     * Post-condition: No state change
+     */
+    uint64_t rowBits(int y, int x) const;
+
+    /*
+     * Description: Check whether two masks share a set pixel, with each
+     *              mask's top-left corner at the given screen position
+     * Return: bool - true if any pixel is set in both
+     * Pre-condition: None
+     * Post-condition: No state change; one shift and AND per word of a
+     *                 per overlapping row
+     */
+    static bool overlaps(const SpriteMask& a, int ax, int ay, const SpriteMask& b, int bx, int by);
+
+    /*
+     * Description: Get mask dimensions
+     * Return: int - width or height in pixels
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+};
+
+#endif /* SpriteMask_h */
@@ -0,0 +1,140 @@
+//================================================================
+// StateStream.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: State Streams
+// Description: Byte writer and bounds-checked reader for saving and
+//              restoring simulation state field by field
+//================================================================
+
+#ifndef StateStream_h
+#define StateStream_h
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Fields are copied in host byte order: a saved state is only read back
+// by the build that wrote it (session version and state checks catch the rest)
+
+class StateWriter {
+private:
+    std::vector<uint8_t>& out;   // Bytes are appended here
+    size_t                used;  // Bytes of out written so far (out may run ahead)
+
+    /*
+     * Description: Make room for bytes more bytes
+     * Return: uint8_t* - where they go
+     * Pre-condition: None
+     * Post-condition: out grows by whole chunks, so once its capacity
+     *                 fits a state, writes are a compare and a copy
+     */
+    uint8_t* claim(size_t bytes) {
+        if(out.size() - used < bytes) out.resize(std::max(used + bytes, out.capacity()));
+        uint8_t* at = out.data() + used;
+        used += bytes;
+        return at;
+    }
+
+public:
+    /*
+     * Description: Write into a buffer
+     * Return: None (constructor)
+     * Pre-condition: buffer outlives the writer
+     * Post-condition: Writes append to buffer
+     */
+    explicit StateWriter(std::vector<uint8_t>& buffer) : out(buffer), used{buffer.size()} {}
+
+    /*
+     * Description: Trim the buffer to what was written
+     * Return: None (destructor)
+     * Pre-condition: None
+     * Post-condition: buffer ends at the last byte written, capacity kept
+     */
+    ~StateWriter() { out.resize(used); }
+
+    StateWriter(const StateWriter&) = delete;
+    StateWriter& operator=(const StateWriter&) = delete;
+
+    /*
+     * Description: Append one plain field, or a length and an array of them
+     * Return: void
+     * Pre-condition: T is trivially copyable
+     * Post-condition: Bytes appended
+     */
+    template <class T>
+    void put(const T& value) {
+        std::memcpy(claim(sizeof(T)), &value, sizeof(T));
+    }
+
+    template <class T>
+    void putArray(const std::vector<T>& values) {
+        put(static_cast<uint32_t>(values.size()));
+        if(!values.empty()) std::memcpy(claim(values.size() * sizeof(T)), values.data(), values.size() * sizeof(T));
+    }
+};
+
+class StateReader {
+private:
+    const uint8_t* pos;   // Next byte to read
+    const uint8_t* end;   // One past the last byte
+    bool           ok;    // No read has run past the end
+
+public:
+    /*
+     * Description: Read from a block of bytes
+     * Return: None (constructor)
+     * Pre-condition: data holds size bytes and outlives the reader
+     * Post-condition: Reads start at data
+     */
+    StateReader(const uint8_t* data, size_t size) : pos{data}, end{data + size}, ok{true} {}
+
+    /*
+     * Description: Read one plain field, or a length and an array of them
+     * Return: void
+     * Pre-condition: T is trivially copyable
+     * Post-condition: value filled, or left alone and good() false if the
+     *                 block is too short; arrays reuse the vector's capacity
+     */
+    template <class T>
+    void get(T& value) {
+        if(!ok || static_cast<size_t>(end - pos) < sizeof(T)) {
+            ok = false;
+            return;
+        }
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+    }
+
+    template <class T>
+    void getArray(std::vector<T>& values) {
+        uint32_t count = 0;
+        get(count);
+        if(!ok || static_cast<size_t>(end - pos) / sizeof(T) < count) {
+            ok = false;
+            return;
+        }
+        values.resize(count);
+        std::memcpy(values.data(), pos, count * sizeof(T));
+        pos += count * sizeof(T);
+    }
+
+    /*
+     * Description: Check the reads so far
+     * Return: bool - true if every read fit; size_t - bytes left
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    bool good() const { return ok; }
+    size_t remaining() const { return static_cast<size_t>(end - pos); }
+
+    /*
+     * Description: Reject the block (a field read back out of range)
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: good() false
+     */
+    void fail() { ok = false; }
+};
+
+#endif /* StateStream_h */
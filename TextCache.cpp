@@ -0,0 +1,260 @@
+//================================================================
+// TextCache.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Text Run Cache Implementation
+// Description: LRU bookkeeping, number formatting, and digit-level
+//              run updates
+//================================================================
+
+#include "TextCache.h"
+#include <cstring>
+
+// NUMBER FORMATTING (no allocation)
+int formatNumber(int value, char* buffer, int size) {
+    char reversed[12];
+    int count = 0;
+    unsigned int magnitude = value < 0 ? 0u - static_cast<unsigned int>(value)
+                                       : static_cast<unsigned int>(value);
+    do {
+        reversed[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while(magnitude != 0);
+    if(value < 0) reversed[count++] = '-';
+
+    int length = 0;
+    while(count > 0 && length < size - 1) {
+        buffer[length++] = reversed[--count];
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+// FNV-1a OVER FONT AND TEXT
+static uint64_t hashText(const char* text, FontSize font) {
+    uint64_t h = 1469598103934665603ULL;
+    h = (h ^ static_cast<uint64_t>(font)) * 1099511628211ULL;
+    for(const char* p = text; *p; ++p) {
+        h = (h ^ static_cast<unsigned char>(*p)) * 1099511628211ULL;
+    }
+    return h;
+}
+
+// TEXT CACHE IMPLEMENTATION
+
+TextCache::TextCache(size_t capBytes, int slots)
+    : entries(slots),
+      head{-1},
+      tail{-1},
+      maxBytes{capBytes},
+      bytesUsed{0},
+      hits{0},
+      misses{0},
+      evictions{0}
+{
+    index.reserve(slots);
+    for(auto& e : entries) e.used = false;
+}
+
+void TextCache::unlink(int slot) {
+    Entry& e = entries[slot];
+    if(e.prev >= 0) entries[e.prev].next = e.next; else head = e.next;
+    if(e.next >= 0) entries[e.next].prev = e.prev; else tail = e.prev;
+    e.prev = e.next = -1;
+}
+
+void TextCache::pushFront(int slot) {
+    Entry& e = entries[slot];
+    e.prev = -1;
+    e.next = head;
+    if(head >= 0) entries[head].prev = slot;
+    head = slot;
+    if(tail < 0) tail = slot;
+}
+
+void TextCache::evict(int slot) {
+    Entry& e = entries[slot];
+    unlink(slot);
+    index.erase(e.hash);
+    bytesUsed -= e.run.byteSize() + e.text.size();
+    e.used = false;
+    evictions++;
+}
+
+int TextCache::freeSlot() {
+    for(size_t i = 0; i < entries.size(); i++) {
+        if(!entries[i].used) return static_cast<int>(i);
+    }
+    int slot = tail;
+    evict(slot);
+    return slot;
+}
+
+const TextRun& TextCache::lookup(const char* text, FontSize font) {
+    uint64_t h = hashText(text, font);
+
+    // HIT
+    auto found = index.find(h);
+    if(found != index.end()) {
+        Entry& e = entries[found->second];
+        if(e.font == font && e.text == text) {
+            hits++;
+            unlink(found->second);
+            pushFront(found->second);
+            return e.run;
+        }
+        evict(found->second);  // Hash collision - replace the old entry
+    }
+
+    // MISS - rasterize into a free (or least recently used) slot
+    misses++;
+    int slot = freeSlot();
+    Entry& e = entries[slot];
+    e.text = text;
+    e.font = font;
+    e.hash = h;
+    FontRenderer::rasterize(text, font, e.run);
+    e.used = true;
+    bytesUsed += e.run.byteSize() + e.text.size();
+    index[h] = slot;
+    pushFront(slot);
+
+    // STAY UNDER THE MEMORY CAP (never evict the entry just built)
+    while(bytesUsed > maxBytes && tail != slot) {
+        evict(tail);
+    }
+    return e.run;
+}
+
+void TextCache::clear() {
+    for(size_t i = 0; i < entries.size(); i++) {
+        if(entries[i].used) {
+            entries[i].used = false;
+            entries[i].prev = entries[i].next = -1;
+        }
+    }
+    index.clear();
+    head = tail = -1;
+    bytesUsed = 0;
+}
+
+// GLYPH CACHE IMPLEMENTATION
+
+GlyphCache::GlyphCache(size_t capBytes, int slots)
+    : entries(slots),
+      clock{0},
+      maxBytes{capBytes},
+      bytesUsed{0},
+      hits{0},
+      misses{0},
+      evictions{0}
+{
+    index.reserve(slots);
+    for(auto& e : entries) e.used = false;
+}
+
+void GlyphCache::evict(int slot) {
+    Entry& e = entries[slot];
+    index.erase(e.key);
+    bytesUsed -= e.run.byteSize();
+    e.used = false;
+    evictions++;
+}
+
+// LEAST RECENTLY USED SLOT OTHER THAN keep (-1 if none), OR A FREE ONE IF takeFree
+int GlyphCache::oldestSlot(int keep, bool takeFree) const {
+    int oldest = -1;
+    for(size_t i = 0; i < entries.size(); i++) {
+        int slot = static_cast<int>(i);
+        if(slot == keep) continue;
+        if(!entries[i].used) {
+            if(takeFree) return slot;
+            continue;
+        }
+        if(oldest < 0 || entries[i].lastUsed < entries[oldest].lastUsed) oldest = slot;
+    }
+    return oldest;
+}
+
+const TextRun& GlyphCache::lookup(char ch, int scaleSteps) {
+    uint32_t key = (static_cast<uint32_t>(scaleSteps) << 8) | static_cast<unsigned char>(ch);
+    clock++;
+
+    // HIT
+    auto found = index.find(key);
+    if(found != index.end()) {
+        hits++;
+        Entry& e = entries[found->second];
+        e.lastUsed = clock;
+        return e.run;
+    }
+
+    // MISS - resample into a free (or least recently used) slot
+    misses++;
+    int slot = oldestSlot(-1, true);
+    if(entries[slot].used) evict(slot);
+
+    Entry& e = entries[slot];
+    e.key = key;
+    e.lastUsed = clock;
+    FontRenderer::rasterizeScaledGlyph(ch, scaleSteps, e.run);
+    e.used = true;
+    bytesUsed += e.run.byteSize();
+    index[key] = slot;
+
+    // STAY UNDER THE MEMORY CAP (never evict the entry just built)
+    while(bytesUsed > maxBytes) {
+        int victim = oldestSlot(slot, false);
+        if(victim < 0) break;
+        evict(victim);
+    }
+    return e.run;
+}
+
+void GlyphCache::clear() {
+    for(auto& e : entries) e.used = false;
+    index.clear();
+    bytesUsed = 0;
+}
+
+// NUMBER RUN IMPLEMENTATION
+
+NumberRun::NumberRun(FontSize numberFont)
+    : font{numberFont},
+      length{-1}
+{
+    digits[0] = '\0';
+    int maxWidth = NUMBER_RUN_MAX_DIGITS * FontRenderer::getAdvance(font);
+    run.bits.reserve(static_cast<size_t>((maxWidth + 31) / 32) * FontRenderer::getLineHeight(font));
+}
+
+void NumberRun::set(int value) {
+    char next[NUMBER_RUN_MAX_DIGITS + 1];
+    int count = formatNumber(value, next, sizeof(next));
+    int advance = FontRenderer::getAdvance(font);
+
+    // DIGIT COUNT CHANGED - rebuild every cell
+    if(count != length) {
+        run.reset(count * advance, FontRenderer::getLineHeight(font));
+        for(int i = 0; i < count; i++) {
+            FontRenderer::rasterizeGlyph(next[i], font, i * advance, run);
+        }
+        std::memcpy(digits, next, count + 1);
+        length = count;
+        return;
+    }
+
+    // SAME LENGTH - only touch cells whose digit changed
+    for(int i = 0; i < count; i++) {
+        if(next[i] != digits[i]) {
+            run.clearColumns(i * advance, (i + 1) * advance);
+            FontRenderer::rasterizeGlyph(next[i], font, i * advance, run);
+            digits[i] = next[i];
+        }
+    }
+}
+
+void NumberRun::draw(SDL_Plotter& g, int x, int y, color c, int flashTimer) const {
+    if(length <= 0 || FontRenderer::isFlashHidden(flashTimer, font)) return;
+
+    FontRenderer::drawRun(g, x, y, c, run);
+}
@@ -0,0 +1,205 @@
+//================================================================
+// TextCache.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Text Run Cache
+// Description: LRU cache of pre-rasterized strings and in-place
+//              updated number runs for the HUD
+//================================================================
+
+#ifndef TextCache_h
+#define TextCache_h
+
+#include "Const.h"
+#include "Font.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+/*
+ * Description: Write value as decimal digits into a fixed buffer
+ * Return: int - number of characters written (excluding terminator)
+ * Pre-condition: buffer holds at least size bytes, size >= 2
+ * Post-condition: buffer holds a terminated string, truncated to fit
+ */
+int formatNumber(int value, char* buffer, int size);
+
+class TextCache {
+private:
+    struct Entry {
+        std::string text;    // Cached string
+        FontSize    font;    // Font it was rasterized in
+        uint64_t    hash;    // Hash of (text, font)
+        TextRun     run;     // Rasterized mask
+        int         prev;    // More recently used entry (-1 = head)
+        int         next;    // Less recently used entry (-1 = tail)
+        bool        used;    // Slot holds a live entry
+    };
+
+    std::vector<Entry> entries;                // Fixed pool of slots
+    std::unordered_map<uint64_t, int> index;   // hash -> slot
+    int    head;          // Most recently used slot
+    int    tail;          // Least recently used slot
+    size_t maxBytes;      // Memory cap for all cached masks
+    size_t bytesUsed;     // Bytes currently held
+    long   hits;          // Lookups served from cache
+    long   misses;        // Lookups that rasterized
+    long   evictions;     // Entries dropped to stay under the cap
+
+    void unlink(int slot);
+    void pushFront(int slot);
+    void evict(int slot);
+    int  freeSlot();
+
+public:
+    /*
+     * Description: Create empty cache with a memory cap
+     * Return: None (constructor)
+     * Pre-condition: capBytes > 0, slots > 0
+     * Post-condition: Cache created with all slots free
+     */
+    TextCache(size_t capBytes, int slots);
+
+    /*
+     * Description: Get the rasterized run for a string, building it on a miss
+     * Return: const TextRun& - valid until the next lookup
+     * Pre-condition: text is a terminated string
+     * Post-condition: Entry is most recently used; LRU entries evicted if over cap
+     */
+    const TextRun& lookup(const char* text, FontSize font);
+
+    /*
+     * Description: Drop every cached run
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Cache empty, counters kept
+     */
+    void clear();
+
+    /*
+     * Description: Get bytes currently held by cached masks
+     * Return: size_t - bytes used
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    size_t getBytesUsed() const { return bytesUsed; }
+
+    /*
+     * Description: Get hit, miss, and eviction counts
+     * Return: long - counter value
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    long getHits() const { return hits; }
+    long getMisses() const { return misses; }
+    long getEvictions() const { return evictions; }
+};
+
+class GlyphCache {
+private:
+    struct Entry {
+        uint32_t      key;        // (scale steps << 8) | character
+        TextRun       run;        // Resampled glyph mask
+        unsigned long lastUsed;   // Lookup clock at last use
+        bool          used;       // Slot holds a live entry
+    };
+
+    std::vector<Entry> entries;                // Fixed pool of slots
+    std::unordered_map<uint32_t, int> index;   // key -> slot
+    unsigned long clock;  // Incremented on every lookup
+    size_t maxBytes;      // Memory cap for all cached masks
+    size_t bytesUsed;     // Bytes currently held
+    long   hits;          // Lookups served from cache
+    long   misses;        // Lookups that resampled
+    long   evictions;     // Entries dropped to stay under the cap
+
+    void evict(int slot);
+    int  oldestSlot(int keep, bool takeFree) const;
+
+public:
+    /*
+     * Description: Create empty scaled-glyph cache with a memory cap
+     * Return: None (constructor)
+     * Pre-condition: capBytes > 0, slots > 0
+     * Post-condition: Cache created with all slots free
+     */
+    GlyphCache(size_t capBytes, int slots);
+
+    /*
+     * Description: Get one glyph at a quantized scale, resampling it on a miss
+     * Return: const TextRun& - valid until the next lookup
+     * Pre-condition: ch is uppercase, scaleSteps >= 1
+     * Post-condition: Entry is most recently used; oldest entries evicted if over cap
+     */
+    const TextRun& lookup(char ch, int scaleSteps);
+
+    /*
+     * Description: Drop every cached glyph
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Cache empty, counters kept
+     */
+    void clear();
+
+    /*
+     * Description: Get bytes held by cached masks and the cap
+     * Return: size_t - byte count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    size_t getBytesUsed() const { return bytesUsed; }
+    size_t getCapacityBytes() const { return maxBytes; }
+
+    /*
+     * Description: Get hit, miss, and eviction counts
+     * Return: long - counter value
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    long getHits() const { return hits; }
+    long getMisses() const { return misses; }
+    long getEvictions() const { return evictions; }
+};
+
+class NumberRun {
+private:
+    FontSize font;                             // Font used for digits
+    TextRun  run;                              // One glyph cell per digit
+    char     digits[NUMBER_RUN_MAX_DIGITS + 1]; // Currently rasterized digits
+    int      length;                           // Digit count, -1 before first set
+
+public:
+    /*
+     * Description: Create an empty number run
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: Mask storage reserved for NUMBER_RUN_MAX_DIGITS
+     */
+    explicit NumberRun(FontSize numberFont = FONT_SMALL);
+
+    /*
+     * Description: Show a new value, re-rasterizing only changed digits
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Run mask matches value
+     */
+    void set(int value);
+
+    /*
+     * Description: Draw the current value as one cached blit
+     * Return: void
+     * Pre-condition: SDL_Plotter g is initialized
+     * Post-condition: Number rendered unless hidden by flash
+     */
+    void draw(SDL_Plotter& g, int x, int y, color c, int flashTimer = 0) const;
+
+    /*
+     * Description: Get the digits currently shown
+     * Return: const char* - terminated digit string
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    const char* c_str() const { return digits; }
+};
+
+#endif /* TextCache_h */
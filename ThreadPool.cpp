@@ -0,0 +1,81 @@
+//================================================================
+// ThreadPool.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Thread Pool Implementation
+// Description: Worker wake-up, task claiming, and job completion
+//================================================================
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int threads)
+    : task{nullptr},
+      taskCount{0},
+      nextTask{0},
+      busy{0},
+      generation{0},
+      stopping{false}
+{
+    if(threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+    if(threads <= 0) threads = 1;
+
+    for(int i = 1; i < threads; i++) {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(auto& w : workers) w.join();
+}
+
+// CLAIM TASKS UNTIL THE JOB IS EXHAUSTED
+void ThreadPool::drain() {
+    for(;;) {
+        int i = nextTask.fetch_add(1);
+        if(i >= taskCount) return;
+        (*task)(i);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    unsigned seen = 0;
+    std::unique_lock<std::mutex> guard(lock);
+    for(;;) {
+        wake.wait(guard, [&]{ return stopping || generation != seen; });
+        if(stopping) return;
+        seen = generation;
+
+        guard.unlock();
+        drain();
+        guard.lock();
+
+        // EVERY WORKER CHECKS IN, SO NONE CAN LAG INTO THE NEXT JOB
+        if(--busy == 0) done.notify_all();
+    }
+}
+
+void ThreadPool::run(int tasks, const std::function<void(int)>& fn) {
+    if(workers.empty()) {
+        for(int i = 0; i < tasks; i++) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        task = &fn;
+        taskCount = tasks;
+        nextTask = 0;
+        busy = static_cast<int>(workers.size());
+        generation++;
+    }
+    wake.notify_all();
+
+    drain();
+
+    std::unique_lock<std::mutex> guard(lock);
+    done.wait(guard, [&]{ return busy == 0; });
+}
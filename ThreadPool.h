@@ -0,0 +1,69 @@
+//================================================================
+// ThreadPool.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Thread Pool
+// Description: Persistent worker threads for splitting one job
+//              into indexed tasks (row bands, frame ranges)
+//================================================================
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex               lock;
+    std::condition_variable  wake;        // Signals a new job or shutdown
+    std::condition_variable  done;        // Signals all workers finished a job
+    const std::function<void(int)>* task; // Current job
+    int              taskCount;           // Tasks in the current job
+    std::atomic<int> nextTask;            // Next unclaimed task index
+    int              busy;                // Workers still on the current job
+    unsigned         generation;          // Bumped once per job
+    bool             stopping;
+
+    void workerLoop();
+    void drain();
+
+public:
+    /*
+     * Description: Start worker threads
+     * Return: None (constructor)
+     * Pre-condition: threads >= 0 (0 = one per hardware thread)
+     * Post-condition: threads - 1 workers waiting; the caller is the last thread
+     */
+    explicit ThreadPool(int threads = 0);
+
+    /*
+     * Description: Stop and join all workers
+     * Return: None (destructor)
+     * Pre-condition: No job running
+     * Post-condition: All worker threads joined
+     */
+    ~ThreadPool();
+
+    /*
+     * Description: Run fn(0) .. fn(tasks - 1) across the pool and wait
+     * Return: void
+     * Pre-condition: fn is safe to call concurrently for different indices
+     * Post-condition: Every task has finished
+     */
+    void run(int tasks, const std::function<void(int)>& fn);
+
+    /*
+     * Description: Get threads that execute tasks, including the caller
+     * Return: int - thread count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getThreadCount() const { return static_cast<int>(workers.size()) + 1; }
+};
+
+#endif /* ThreadPool_h */
@@ -0,0 +1,207 @@
+//================================================================
+// UI.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Retained UI Tree Implementation
+// Description: Node bookkeeping, damage merging, and clipped repaint
+//================================================================
+
+#include "UI.h"
+
+const int UI_MAX_DAMAGE_RECTS = 8;
+
+// RECT HELPERS
+static bool intersects(const UIRect& a, const UIRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w &&
+           a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static UIRect intersection(const UIRect& a, const UIRect& b) {
+    int x0 = max(a.x, b.x);
+    int y0 = max(a.y, b.y);
+    int x1 = min(a.x + a.w, b.x + b.w);
+    int y1 = min(a.y + a.h, b.y + b.h);
+    return UIRect{ x0, y0, max(0, x1 - x0), max(0, y1 - y0) };
+}
+
+static UIRect unite(const UIRect& a, const UIRect& b) {
+    int x0 = min(a.x, b.x);
+    int y0 = min(a.y, b.y);
+    int x1 = max(a.x + a.w, b.x + b.w);
+    int y1 = max(a.y + a.h, b.y + b.h);
+    return UIRect{ x0, y0, x1 - x0, y1 - y0 };
+}
+
+// UI TREE IMPLEMENTATION
+
+UITree::UITree() : fullRepaint{true}, paintedPixels{0} {
+    damage.reserve(UI_MAX_DAMAGE_RECTS);
+}
+
+bool UITree::isShown(int node) const {
+    const UINode& n = nodes[node];
+    if(!n.visible || (n.flashing && !n.flashOn)) return false;
+    return n.parent < 0 || isShown(n.parent);
+}
+
+void UITree::damageRect(const UIRect& r) {
+    if(r.w <= 0 || r.h <= 0 || fullRepaint) return;
+
+    // MERGE INTO AN OVERLAPPING RECT
+    for(auto& d : damage) {
+        if(intersects(d, r)) {
+            d = unite(d, r);
+            return;
+        }
+    }
+
+    // TOO MANY PIECES - COLLAPSE INTO ONE
+    if(static_cast<int>(damage.size()) >= UI_MAX_DAMAGE_RECTS) {
+        UIRect all = r;
+        for(const auto& d : damage) all = unite(all, d);
+        damage.clear();
+        damage.push_back(all);
+        return;
+    }
+    damage.push_back(r);
+}
+
+void UITree::damageNode(int node) {
+    damageRect(nodes[node].bounds);
+}
+
+void UITree::labelBounds(UINode& node) {
+    if(node.scale > 0) {
+        node.bounds.w = FontRenderer::measureScaled(node.text.c_str(), node.scale);
+        node.bounds.h = FontRenderer::getScaledLineHeight(node.scale);
+        return;
+    }
+    node.bounds.w = FontRenderer::measureText(node.text.c_str(), node.font);
+    node.bounds.h = FontRenderer::getLineHeight(node.font);
+}
+
+int UITree::addPanel(int parent, int x, int y, int w, int h, color c) {
+    UINode n;
+    n.kind = UI_PANEL;
+    n.parent = parent;
+    n.bounds = UIRect{ x, y, w, h };
+    n.fill = c;
+    n.font = FONT_SMALL;
+    n.scale = 0;
+    n.visible = true;
+    n.flashing = false;
+    n.flashOn = true;
+    n.shown = true;
+    nodes.push_back(n);
+    damageNode(static_cast<int>(nodes.size()) - 1);
+    return static_cast<int>(nodes.size()) - 1;
+}
+
+int UITree::addLabel(int parent, int x, int y, const std::string& text, FontSize font,
+                     color c, bool flashing) {
+    UINode n;
+    n.kind = UI_LABEL;
+    n.parent = parent;
+    n.bounds = UIRect{ x, y, 0, 0 };
+    n.fill = c;
+    n.text = text;
+    n.font = font;
+    n.scale = 0;
+    n.visible = true;
+    n.flashing = flashing;
+    n.flashOn = true;
+    n.shown = true;
+    labelBounds(n);
+    nodes.push_back(n);
+    damageNode(static_cast<int>(nodes.size()) - 1);
+    return static_cast<int>(nodes.size()) - 1;
+}
+
+int UITree::addScaledLabel(int parent, int x, int y, const std::string& text, float scale,
+                           color c, bool flashing) {
+    int node = addLabel(parent, x, y, text, FONT_LARGE, c, flashing);
+    nodes[node].scale = scale;
+    labelBounds(nodes[node]);
+    damageNode(node);
+    return node;
+}
+
+void UITree::setText(int node, const std::string& text) {
+    UINode& n = nodes[node];
+    if(n.text == text) return;
+
+    damageNode(node);
+    n.text = text;
+    labelBounds(n);
+    damageNode(node);
+}
+
+void UITree::setColor(int node, color c) {
+    UINode& n = nodes[node];
+    if(n.fill.R == c.R && n.fill.G == c.G && n.fill.B == c.B) return;
+
+    n.fill = c;
+    damageNode(node);
+}
+
+void UITree::setPosition(int node, int x, int y) {
+    UINode& n = nodes[node];
+    if(n.bounds.x == x && n.bounds.y == y) return;
+
+    damageNode(node);
+    n.bounds.x = x;
+    n.bounds.y = y;
+    damageNode(node);
+}
+
+void UITree::setVisible(int node, bool visible) {
+    if(nodes[node].visible == visible) return;
+
+    nodes[node].visible = visible;
+    damageNode(node);
+}
+
+void UITree::update(int flashTimer) {
+    for(size_t i = 0; i < nodes.size(); i++) {
+        UINode& n = nodes[i];
+        if(n.flashing) {
+            n.flashOn = !FontRenderer::isFlashHidden(flashTimer, n.font);
+        }
+
+        // PARENTS COME FIRST, SO THEIR shown IS ALREADY CURRENT
+        bool nowShown = n.visible && n.flashOn && (n.parent < 0 || nodes[n.parent].shown);
+        if(nowShown != n.shown) {
+            n.shown = nowShown;
+            damageNode(static_cast<int>(i));
+        }
+    }
+}
+
+void UITree::paint(SDL_Plotter& g, const UIRect& clip) {
+    for(size_t i = 0; i < nodes.size(); i++) {
+        const UINode& n = nodes[i];
+        if(!intersects(n.bounds, clip) || !isShown(static_cast<int>(i))) continue;
+
+        if(n.kind == UI_PANEL) {
+            UIRect r = intersection(n.bounds, clip);
+            g.fillRect(r.x, r.y, r.w, r.h, n.fill);
+        } else if(n.scale > 0) {
+            FontRenderer::drawScaled(g, n.bounds.x, n.bounds.y, n.fill, n.text.c_str(), n.scale, 0);
+        } else {
+            FontRenderer::drawText(g, n.bounds.x, n.bounds.y, n.fill, n.text.c_str(), n.font, 0);
+        }
+    }
+    paintedPixels += clip.w * clip.h;
+}
+
+void UITree::render(SDL_Plotter& g) {
+    paintedPixels = 0;
+
+    if(fullRepaint) {
+        paint(g, UIRect{ 0, 0, ROW, COL });
+    } else {
+        for(const auto& d : damage) paint(g, d);
+    }
+
+    damage.clear();
+    fullRepaint = false;
+}
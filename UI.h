@@ -0,0 +1,155 @@
+//================================================================
+// UI.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Retained UI Tree
+// Description: Panels and labels built once per screen, with flash
+//              animation and damage-tracked partial repaint
+//================================================================
+
+#ifndef UI_h
+#define UI_h
+
+#include "Const.h"
+#include "Font.h"
+#include <string>
+#include <vector>
+
+// SCREEN-SPACE RECTANGLE
+struct UIRect {
+    int x, y, w, h;
+};
+
+enum UINodeKind {
+    UI_PANEL,
+    UI_LABEL
+};
+
+struct UINode {
+    UINodeKind  kind;       // Panel (filled rect) or label (text)
+    int         parent;     // Parent node index, -1 for roots
+    UIRect      bounds;     // Area covered on screen
+    color       fill;       // Panel fill or text color
+    std::string text;       // Label text
+    FontSize    font;       // Label font
+    float       scale;      // Label scale of the large glyphs (drawScaled), 0 to use font
+    bool        visible;    // Set by the owning screen
+    bool        flashing;   // Blinks with the screen's flash timer
+    bool        flashOn;    // Current flash phase
+    bool        shown;      // Visibility as of the last update
+};
+
+class UITree {
+private:
+    std::vector<UINode> nodes;    // Paint order: parents before children
+    std::vector<UIRect> damage;   // Regions to repaint next render
+    bool fullRepaint;             // Whole tree needs repainting
+    int  paintedPixels;           // Pixels covered by last render's damage
+
+    bool isShown(int node) const;
+    void damageRect(const UIRect& r);
+    void damageNode(int node);
+    void labelBounds(UINode& node);
+    void paint(SDL_Plotter& g, const UIRect& clip);
+
+public:
+    /*
+     * Description: Create an empty UI tree
+     * Return: None (constructor)
+     * Pre-condition: None
+     * Post-condition: No nodes, full repaint pending
+     */
+    UITree();
+
+    /*
+     * Description: Add a filled panel
+     * Return: int - node index
+     * Pre-condition: parent is -1 or an existing node
+     * Post-condition: Panel appended and damaged
+     */
+    int addPanel(int parent, int x, int y, int w, int h, color c);
+
+    /*
+     * Description: Add a text label
+     * Return: int - node index
+     * Pre-condition: parent is -1 or an existing node
+     * Post-condition: Label appended and damaged
+     */
+    int addLabel(int parent, int x, int y, const std::string& text, FontSize font,
+                 color c, bool flashing = false);
+
+    /*
+     * Description: Add a text label drawn at any scale of the large font
+     * Return: int - node index
+     * Pre-condition: parent is -1 or an existing node; scale > 0
+     * Post-condition: Label appended and damaged; glyphs come from the
+     *                 shared scaled-glyph cache
+     */
+    int addScaledLabel(int parent, int x, int y, const std::string& text, float scale,
+                       color c, bool flashing = false);
+
+    /*
+     * Description: Change a label's text
+     * Return: void
+     * Pre-condition: node is a label
+     * Post-condition: Old and new bounds damaged if text changed
+     */
+    void setText(int node, const std::string& text);
+
+    /*
+     * Description: Change a node's color
+     * Return: void
+     * Pre-condition: node exists
+     * Post-condition: Node damaged if color changed
+     */
+    void setColor(int node, color c);
+
+    /*
+     * Description: Move a node
+     * Return: void
+     * Pre-condition: node exists
+     * Post-condition: Old and new bounds damaged if moved
+     */
+    void setPosition(int node, int x, int y);
+
+    /*
+     * Description: Show or hide a node and its children
+     * Return: void
+     * Pre-condition: node exists
+     * Post-condition: Node damaged if visibility changed
+     */
+    void setVisible(int node, bool visible);
+
+    /*
+     * Description: Advance flash animations
+     * Return: void
+     * Pre-condition: flashTimer is the screen's frame counter
+     * Post-condition: Nodes whose visibility flipped are damaged
+     */
+    void update(int flashTimer);
+
+    /*
+     * Description: Force a full repaint on the next render
+     * Return: void
+     * Pre-condition: None
+     * Post-condition: Whole tree damaged
+     */
+    void invalidate() { fullRepaint = true; }
+
+    /*
+     * Description: Repaint only damaged regions
+     * Return: void
+     * Pre-condition: SDL_Plotter g holds the previous frame of this tree
+     * Post-condition: Damaged regions repainted, damage cleared
+     */
+    void render(SDL_Plotter& g);
+
+    /*
+     * Description: Get pixels repainted by the last render
+     * Return: int - damaged pixel count
+     * Pre-condition: None
+     * Post-condition: No state change
+     */
+    int getPaintedPixels() const { return paintedPixels; }
+};
+
+#endif /* UI_h */
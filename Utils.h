@@ -18,13 +18,17 @@
  * Post-condition: Rectangle drawn with bounds checking
  */
 inline void drawRect(int x, int y, int width, int height, color c, SDL_Plotter& g) {
-    for(int row = y; row < y + height; row++) {
-        for(int col = x; col < x + width; col++) {
-            if(col >= 0 && col < 600 && row >= 0 && row < 600) {
-                g.plotPixel(col, row, c);
-            }
-        }
-    }
+    g.fillRect(x, y, width, height, c);
+}
+
+/*
+ * Description: Pack color into the plotter's 0x00RRGGBB pixel format
+ * Return: Uint32 - packed pixel value
+ * Pre-condition: color channels in [0, 255]
+ * Post-condition: No state change
+ */
+inline Uint32 packColor(const color& c) {
+    return RED_SHIFT * c.R + GREEN_SHIFT * c.G + BLUE_SHIFT * c.B;
 }
 
 #endif /* Utils_h */
@@ -12,64 +12,215 @@
 #include <cctype>
 #include <string>
 #include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <memory>
 #include "SDL_Plotter.h"
-#include "Car.h"
-#include "Background.h"
-#include "Collision.h"
 #include "Screen.h"
-#include "Points.h"
 #include "Const.h"
 #include "Font.h"
+#include "Simulation.h"
+#include "RaceRenderer.h"
+#include "SessionLog.h"
+#include "SessionWriter.h"
+#include "SessionFile.h"
+#include "GameSnapshot.h"
+#include "PostProcess.h"
+#include "TextCache.h"
 
 using namespace std;
 
+// NEW SEED PER RACE
+static uint64_t nextRaceSeed() {
+    static uint64_t races = 0;
+    return (static_cast<uint64_t>(time(0)) << 16) + races++;
+}
+
+// RESET THE RACE (RECORDING STARTS ON ITS FIRST TICK)
+static void startRace(Simulation& sim, RaceRenderer& renderer, bool infiniteMode) {
+    sim.reset(nextRaceSeed(), infiniteMode);
+    renderer.clear();
+}
+
+// RESUME A SNAPSHOT (RETRY FROM THE START, OR FROM THE LAST LAP REACHED)
+static bool resumeRace(Simulation& sim, RaceRenderer& renderer, const GameSnapshot& snapshot) {
+    if (!snapshot.restore(sim)) return false;
+    renderer.clear();
+    return true;
+}
+
+// CRASH DUMP - the race state after each of the last two ticks, so the one
+// a fatal signal finds is never half written
+static GameSnapshot crashSnapshots[2];
+static volatile sig_atomic_t crashSlot = -1;  // Complete snapshot, -1 before the first tick
+
+static void captureCrashDump(const Simulation& sim) {
+    int slot = (crashSlot == 0) ? 1 : 0;
+    crashSnapshots[slot].capture(sim);
+    atomic_signal_fence(memory_order_release);
+    crashSlot = slot;
+}
+
+static void writeCrashDump(int sig) {
+    if (crashSlot >= 0) crashSnapshots[crashSlot].save(SNAPSHOT_CRASH_PATH);
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+// CLOSE THE CURRENT RECORDING
+static void saveRace(SessionWriter& recorder, const string& path) {
+    if (!recorder.isRecording()) return;
+    uint64_t ticks = recorder.getTickCount();
+    if (!recorder.finish()) {
+        cout << "Could not write " << path << endl;
+    } else {
+        cout << "Recorded " << ticks << " ticks to " << path << endl;
+    }
+}
+
 int main(int argc, char **argv) {
-    srand((unsigned)time(0));
+    // --record <file> names the recording every race is streamed to;
+    // --replay <file> plays one back, jumping to --seek <tick> by way of the
+    // nearest keyframe and showing every --speed <n>th tick; --restore <file>
+    // continues a race from a snapshot (e.g. a crash dump), paused
+    string recordPath = SESSION_DEFAULT_PATH;
+    string replayPath;
+    string restorePath;
+    int seekTick = 0;
+    int replaySpeed = 1;
+    for (int i = 1; i + 1 < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--record")      recordPath = argv[i + 1];
+        else if (arg == "--replay") replayPath = argv[i + 1];
+        else if (arg == "--restore") restorePath = argv[i + 1];
+        else if (arg == "--seek")   seekTick = max(0, atoi(argv[i + 1]));
+        else if (arg == "--speed")  replaySpeed = max(1, atoi(argv[i + 1]));
+    }
 
     SDL_Plotter g(ROW, COL);
-    PlayerCar playerCar(PLAYER_START_X, PLAYER_START_Y, PLAYER_CAR);
-    Background bg;
-    PointsManager points;
-
-    vector<AICar> aiCars = {
-        AICar(LEFT_LANE_X,   -50,  AI_BLUE,  4),
-        AICar(CENTER_LANE_X, -150, AI_GREEN, 3),
-        AICar(RIGHT_LANE_X,  -250, AI_YELLOW,5)
-    };
-    vector<Obstacle> obstacles = {
-        Obstacle(LEFT_LANE_X,   -100, OBSTACLE_SIZE),
-        Obstacle(CENTER_LANE_X, -300, OBSTACLE_SIZE),
-        Obstacle(RIGHT_LANE_X,  -500, OBSTACLE_SIZE)
-    };
+    Simulation sim;
+    RaceRenderer renderer;
+    SessionWriter recorder;
+    SessionLog replay;
+    vector<Uint8> keyframe;  // Race state buffer for the recording's keyframes
+    GameSnapshot raceStart;     // Current race at tick 0 (R retries it)
+    GameSnapshot lapCheckpoint; // Current race when its lap last changed (L resumes it)
+    int checkpointLap = 0;
+    ThreadPool pool;
+    PostPipeline post(pool);
+    int budgetEventsSeen = 0;  // Post-process budget events already reported
+    // JOB SYSTEM - only when the pools can hold JOB_PARALLEL_ENTITIES, since
+    // smaller races never hand it work and its workers would sit idle
+    unique_ptr<JobSystem> jobs;
+    const EntityStore& pools = sim.getEntities();
+    if (pools.getAICapacity() + pools.getObstacleCapacity() >= JOB_PARALLEL_ENTITIES) {
+        jobs.reset(new JobSystem());
+        sim.setJobs(jobs.get());
+    }
+#ifdef PIXEL_RACERS_CABINET
+    g.setFrameFilter(&post);  // Cabinet builds start with CRT filters on
+#endif
 
     GameState gameState = STATE_START;
     bool infiniteMode = false;
+    bool raceInfinite = false;  // Mode in force for the current race
+    bool nightMode = false;
     StartScreen startScreen;
     startScreen.setInfiniteMode(infiniteMode);
 
     InstructionsScreen instructionsScreen;
     PauseScreen pauseScreen;
-    PlayingScreen playingScreen(false);  // Start in normal mode
     GameOverScreen gameOverScreen;
     WinScreen winScreen;
 
-    int collisionCooldown = 0;
-    int frameCount = 0;
+    int drawnState = -1;  // State rendered last frame (menus repaint on entry)
+    startRace(sim, renderer, infiniteMode);
+
+    signal(SIGSEGV, writeCrashDump);
+    signal(SIGABRT, writeCrashDump);
+    signal(SIGFPE, writeCrashDump);
+    signal(SIGILL, writeCrashDump);
+
+    // RESTORE - not recorded, the session format replays from tick 0
+    if (!restorePath.empty()) {
+        if (!lapCheckpoint.load(restorePath) || !resumeRace(sim, renderer, lapCheckpoint)) {
+            cout << "Could not restore " << restorePath << endl;
+            return 1;
+        }
+        raceInfinite = sim.isInfinite();
+        checkpointLap = sim.getLap();
+        gameState = STATE_PAUSED;
+        cout << "Restored tick " << sim.getTick() << " of " << restorePath << endl;
+    }
+
+    // REPLAY - the recorded race starts at once; its log stands in for the keyboard
+    bool replaying = false;
+    if (!replayPath.empty()) {
+        if (!replay.load(replayPath) || replay.getTickCount() == 0) {
+            cout << "Could not read replay " << replayPath << endl;
+            return 1;
+        }
+        replaying = true;
+        nightMode = (replay.getFlags() & SESSION_NIGHT) != 0;
+        startScreen.setNightMode(nightMode);
+        renderer.setNightMode(nightMode);
+        raceInfinite = (replay.getInput(0) & INPUT_INFINITE) != 0;
+        sim.reset(replay.getSeed(), raceInfinite);
+        gameState = STATE_PLAYING;
+        cout << "Replaying " << replay.getTickCount() << " ticks of " << replayPath << endl;
+
+        // SEEK - restore a keyframe short of the seek tick; the ticks left
+        // (at least enough for effects to build up) fast-forward undrawn
+        SessionFile file;
+        int restoreTick = min(seekTick, replay.getTickCount()) - EFFECT_WARMUP_TICKS;
+        if (restoreTick > 0 && file.open(replayPath) && !file.seek(restoreTick, sim)) {
+            sim.reset(replay.getSeed(), raceInfinite);
+        }
+    }
 
     while (!g.getQuit()) {
-        if (g.kbhit()) {
-            char c = toupper(g.getKey());
+        char raceKey = '\0';  // Key fed to this frame's race tick
+
+        // REPLAY END - hand the race to the player, paused
+        bool replayTick = replaying && gameState == STATE_PLAYING;
+        if (replayTick && sim.getTick() >= replay.getTickCount()) {
+            cout << "Replay ended at tick " << sim.getTick() << endl;
+            replaying = replayTick = false;
+            gameState = STATE_PAUSED;
+        }
+
+        while (replayTick && g.kbhit()) g.getKey();  // Keyboard ignored while replaying
+        if (replayTick || g.kbhit()) {
+            char c = replayTick ? static_cast<char>(replay.getInput(sim.getTick()) & INPUT_KEY_MASK)
+                                : static_cast<char>(toupper(g.getKey()));
+
+            // OVERDRAW INSTRUMENTATION - heatmap overlay and per-frame totals
+            if (c == 'O') {
+                g.setOverdrawTracking(!g.getOverdrawTracking());
+                g.setOverdrawHeatmap(g.getOverdrawTracking());
+                c = '\0';
+            }
+
+            // POST-PROCESS FILTERS
+            if (c == 'F') {
+                g.setFrameFilter(g.getFrameFilter() ? nullptr : &post);
+                c = '\0';
+            }
 
             switch (gameState) {
                 case STATE_START:
                     if (c == 'I') {
                         gameState = STATE_INSTRUCTIONS;
                     } else if (c == 'S') {
-                        playingScreen.setInfiniteMode(infiniteMode);
+                        raceInfinite = infiniteMode;
                         gameState = STATE_PLAYING;
                     } else if (c == 'M') {
                         infiniteMode = !infiniteMode;
                         startScreen.setInfiniteMode(infiniteMode);
+                    } else if (c == 'N') {
+                        nightMode = !nightMode;
+                        startScreen.setNightMode(nightMode);
+                        renderer.setNightMode(nightMode);
                     }
                     break;
 
@@ -79,18 +230,16 @@ int main(int argc, char **argv) {
                     break;
 
                 case STATE_PLAYING:
-                    if (playingScreen.handleInput(c)) {
+                    if (sim.isCrashing()) {
+                        break;  // Input locked while crash plays out
+                    } else if (c == 'P') {
                         gameState = STATE_PAUSED;
                     } else if (c == 'Q') {
-                    	winScreen.setWin(points.getScore());
+                    	winScreen.setWin(sim.getScore());
                     	gameState = STATE_WIN;
+                        saveRace(recorder, recordPath);
                     } else {
-                        switch(c) {
-                            case RIGHT_ARROW: playerCar.move(RIGHT_ARROW); break;
-                            case LEFT_ARROW:  playerCar.move(LEFT_ARROW);  break;
-                            case UP_ARROW:    playerCar.move(UP_ARROW);    break;
-                            case DOWN_ARROW:  playerCar.move(DOWN_ARROW);  break;
-                        }
+                        raceKey = c;  // Arrows move the player on this frame's tick
                     }
                     break;
 
@@ -104,29 +253,24 @@ int main(int argc, char **argv) {
 
                 case STATE_GAME_OVER:
                     if (gameOverScreen.handleInput(c)) {
-                        playerCar.respawn();
-                        bg = Background();
-                        points.reset();
-                        playingScreen = PlayingScreen(infiniteMode);
-                        collisionCooldown = 0;
-                        frameCount = 0;
-                        for (auto& ai : aiCars) ai.respawn();
-                        for (auto& obs : obstacles) obs.respawn();
+                        replaying = false;
+                        startRace(sim, renderer, infiniteMode);
                         gameState = STATE_START;
+                    } else if ((c == 'R' && resumeRace(sim, renderer, raceStart)) ||
+                               (c == 'L' && resumeRace(sim, renderer, lapCheckpoint))) {
+                        replaying = false;
+                        gameState = STATE_PLAYING;
                     }
                     break;
 
                 case STATE_WIN:
                     if (winScreen.handleInput(c)) {
-                        playerCar.respawn();
-                        bg = Background();
-                        points.reset();
-                        playingScreen = PlayingScreen(infiniteMode);
-                        collisionCooldown = 0;
-                        frameCount = 0;
-                        for (auto& ai : aiCars) ai.respawn();
-                        for (auto& obs : obstacles) obs.respawn();
+                        replaying = false;
+                        startRace(sim, renderer, infiniteMode);
                         gameState = STATE_START;
+                    } else if (c == 'R' && resumeRace(sim, renderer, raceStart)) {
+                        replaying = false;
+                        gameState = STATE_PLAYING;
                     }
                     break;
             }
@@ -136,93 +280,124 @@ int main(int argc, char **argv) {
             g.getMouseClick();
         }
 
-        g.clear();
+        // FAST-FORWARD - a replay skips drawing and frame pacing before the
+        // seek tick, then shows every replaySpeed-th tick
+        bool drawFrame = !replayTick ||
+                         (sim.getTick() >= seekTick && sim.getTick() % replaySpeed == 0);
+
+        // MENUS ARE RETAINED - only the playing scene redraws from scratch
+        bool entered = (gameState != drawnState);
+        drawnState = gameState;
+        g.setDrawSource(SOURCE_SCREEN);
+        if (gameState == STATE_PLAYING && drawFrame) {
+            g.clear();
+        }
 
         switch (gameState) {
             case STATE_START:
+                if (entered) startScreen.enter();
                 startScreen.update();
                 startScreen.draw(g);
                 break;
 
             case STATE_INSTRUCTIONS:
+                if (entered) instructionsScreen.enter();
                 instructionsScreen.update();
                 instructionsScreen.draw(g);
                 break;
 
             case STATE_PAUSED:
+                if (entered) pauseScreen.enter();
                 pauseScreen.update();
                 pauseScreen.draw(g);
                 break;
 
             case STATE_GAME_OVER:
+                if (entered) gameOverScreen.enter();
                 gameOverScreen.update();
                 gameOverScreen.draw(g);
                 break;
 
             case STATE_WIN:
+                if (entered) winScreen.enter();
                 winScreen.update();
                 winScreen.draw(g);
                 break;
 
             case STATE_PLAYING: {
-                bg.update(playerCar.getSpeed());
-                points.updateSpeed(playerCar.getSpeed());
-                points.update();
-                playerCar.update(bg.getOffset());
-
-                playingScreen.update(points);
-
-                for (auto& ai : aiCars) {
-                    ai.update(bg.getOffset(), obstacles);
-                    if (ai.isOffScreen()) {
-                        ai.respawn();
-                        points.addCarPass();
-                    }
+                Uint8 input = makeTickInput(raceKey, raceInfinite);
+                if (replayTick && !sim.isCrashing() && input != replay.getInput(sim.getTick())) {
+                    cout << "Replay input differs at tick " << sim.getTick() << endl;
                 }
-
-                for (auto& obs : obstacles) {
-                    obs.update(playerCar.getSpeed());
-                    if (obs.isOffScreen()) {
-                        obs.respawn();
-                        points.addObstacleAvoided();
-                    }
+                if (sim.getTick() == 0) {
+                    raceStart.capture(sim);
+                    lapCheckpoint.capture(sim);
+                    checkpointLap = sim.getLap();
                 }
-
-                if (collisionCooldown <= 0) {
-                    bool hitAI = false, hitObstacle = false;
-                    Collision::checkAllCollisions(playerCar, aiCars, obstacles, hitAI, hitObstacle);
-
-                    if (hitAI || hitObstacle) {
-                        playerCar.setSpeed(max(MIN_SPEED, playerCar.getSpeed() - COLLISION_SPEED_PENALTY));
-                        int newScore = max(0, points.getScore() - COLLISION_POINTS_PENALTY);
-                        gameOverScreen.setGameOver(newScore, hitAI, hitObstacle);
-                        gameState = STATE_GAME_OVER;
-                    }
-                } else {
-                    collisionCooldown--;
+                if (sim.getTick() == 0 && !replaying) {
+                    recorder.begin(recordPath, sim.getSeed(), nightMode ? SESSION_NIGHT : 0);
+                } else if (sim.getTick() % KEYFRAME_INTERVAL == 0 && recorder.isRecording()) {
+                    keyframe.clear();
+                    sim.saveState(keyframe);
+                    recorder.addKeyframe(keyframe);
+                }
+                recorder.record(input);
+                TickEvents events = sim.step(input);
+                renderer.onTick(sim, events);
+                captureCrashDump(sim);
+                if (sim.getLap() != checkpointLap) {
+                    lapCheckpoint.capture(sim);
+                    checkpointLap = sim.getLap();
                 }
 
-                if (playingScreen.isWinCondition()) {
-                    winScreen.setWin(points.getScore());
+                if (events.crashed) {
+                    gameOverScreen.setGameOver(events.crashScore, events.hitAI, events.hitObstacle);
+                }
+                if (events.over) {
+                    gameState = STATE_GAME_OVER;
+                    saveRace(recorder, recordPath);
+                }
+                if (events.won) {
+                    winScreen.setWin(sim.getScore());
                     gameState = STATE_WIN;
+                    saveRace(recorder, recordPath);
                 }
 
-                bg.draw(g);
-                for (auto& obs : obstacles) obs.draw(g);
-                for (auto& ai : aiCars) ai.draw(g);
-                playerCar.draw(g);
-                playingScreen.draw(g, points, playerCar);
-
-                frameCount++;
+                if (drawFrame) renderer.draw(g, sim);
                 break;
             }
         }
 
+        post.setSpeed(gameState == STATE_PLAYING && !sim.isCrashing() ? sim.getPlayer().getSpeed() : 0);
+        if (!drawFrame) continue;
+
         g.Sleep(FRAME_DELAY_MS);
         g.update();
+
+        if (post.getBudgetEvents() != budgetEventsSeen) {
+            budgetEventsSeen = post.getBudgetEvents();
+            const PostPass* pass = post.getLastBudgetPass();
+            cout << "post-process: " << (pass->wasAutoDisabled() ? "disabled " : "restored ") << pass->getName()
+                 << " (" << post.getLastBudgetMs() << " ms, budget " << POST_FRAME_BUDGET_MS << " ms)\n";
+        }
+
+        if (g.getOverdrawTracking()) {
+            long written = g.getFrameWrites();
+            long visible = g.getFrameTouched();
+            cout << "overdraw: " << written << " written / " << visible << " visible";
+            if (visible > 0) cout << " (" << static_cast<double>(written) / visible << "x)";
+            for (int s = 0; s < SOURCE_COUNT; s++) {
+                DrawSource source = static_cast<DrawSource>(s);
+                cout << "  " << getDrawSourceName(source) << " " << g.getFrameWrites(source);
+            }
+            const GlyphCache& glyphs = FontRenderer::getGlyphCache();
+            cout << "  glyphs " << glyphs.getBytesUsed() << "/" << glyphs.getCapacityBytes() << " bytes, "
+                 << glyphs.getHits() << " hits, " << glyphs.getEvictions() << " evictions\n";
+        }
     }
 
+    saveRace(recorder, recordPath);
     cout << "\n=== PIXEL RACERS ===\n";
-    cout << "Final Score: " << points.getScore() << endl;
+    cout << "Final Score: " << sim.getScore() << endl;
     return 0;
 }
@@ -0,0 +1,33 @@
+//================================================================
+// AllocCounter.h
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Allocation Counter
+// Description: Replaces the global operator new and delete with ones
+//              that count every heap allocation in the process, for
+//              benchmarks that check hot loops never allocate
+//================================================================
+
+#ifndef AllocCounter_h
+#define AllocCounter_h
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// ALLOCATION COUNTER - every heap allocation in the process; include this
+// header from the benchmark's main file only, since the operators below
+// replace the global ones for the whole program
+static std::atomic<long> allocations(0);
+
+void* operator new(size_t size) {
+    allocations++;
+    void* p = std::malloc(size ? size : 1);
+    if(!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+#endif /* AllocCounter_h */
@@ -0,0 +1,317 @@
+//================================================================
+// batch_sim.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Headless Batch Simulator
+// Description: Plays thousands of races on all cores with a scripted or
+//              bot driver over a grid of race parameters, and reports
+//              survival time, score spread, laps reached, what ended
+//              each race, and simulated ticks per second
+//================================================================
+
+#include "Simulation.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+const int BATCH_GAMES = 1000;                      // Races per grid point
+const int BATCH_TICK_CAP = FPS_TARGET * 60 * 10;   // Ten minutes of play, then a race is a timeout
+const int BOT_LOOKAHEAD = SIZE * 4;                // Pixels ahead the bot watches for threats
+const int BOT_MARGIN = 6;                          // Extra side clearance the bot keeps
+const int BOT_TARGET_SPEED = 8;                    // Speed the bot cruises at
+const int RANDOM_HOLD_MAX = 15;                    // Longest the random driver holds a key
+
+typedef std::chrono::steady_clock Clock;
+
+enum Policy {
+    POLICY_RANDOM,   // Random keys held for random lengths
+    POLICY_CRUISE,   // Accelerate and never steer
+    POLICY_BOT       // Steer away from what is ahead, hold a target speed
+};
+
+enum Outcome {
+    OUTCOME_WON,
+    OUTCOME_AI,
+    OUTCOME_OBSTACLE,
+    OUTCOME_BOTH,
+    OUTCOME_TIMEOUT,
+    OUTCOME_COUNT
+};
+
+const char* OUTCOME_NAMES[OUTCOME_COUNT] = { "won", "ai", "cone", "both", "timeout" };
+
+struct GameResult {
+    int ticks;     // Ticks survived
+    int score;     // Final (or game over) score
+    int lap;       // Lap reached
+    int outcome;   // What ended the race
+};
+
+// SWEEPABLE PARAMETERS
+struct ParamName {
+    const char*      name;
+    int RaceParams::*field;
+};
+
+const ParamName PARAM_NAMES[] = {
+    { "threshold",   &RaceParams::laneChangeThreshold },
+    { "delay",       &RaceParams::laneChangeDelay },
+    { "lookahead",   &RaceParams::laneLookahead },
+    { "aispawn",     &RaceParams::aiSpawnRange },
+    { "conespawn",   &RaceParams::obstacleSpawnRange },
+    { "aispeed",     &RaceParams::aiSpeedBonus },
+    { "traffic",     &RaceParams::trafficPerLap },
+    { "start",       &RaceParams::startTraffic },
+    { "budget",      &RaceParams::aiDecisionBudget }
+};
+const int PARAM_NAME_COUNT = sizeof(PARAM_NAMES) / sizeof(PARAM_NAMES[0]);
+
+struct Sweep {
+    int              param;    // Index into PARAM_NAMES
+    std::vector<int> values;
+};
+
+// DRIVERS
+struct Driver {
+    unsigned state;   // LCG state for the random driver
+    char     held;    // Key being held
+    int      hold;    // Ticks left to hold it
+
+    explicit Driver(unsigned seed) : state{seed * 2654435761u + 1}, held{0}, hold{0} {}
+
+    int next(int range) {
+        state = state * 1103515245u + 12345u;
+        return static_cast<int>((state >> 16) % range);
+    }
+};
+
+static char randomKey(Driver& d) {
+    if(d.hold-- <= 0) {
+        int k = d.next(6);
+        d.held = k < 2 ? 0 : static_cast<char>(k - 1);   // Idle twice as often as each arrow
+        d.hold = 1 + d.next(RANDOM_HOLD_MAX);
+    }
+    return d.held;
+}
+
+// Nearest thing ahead in the player's path: its x, or -1 if the road is clear
+static int nearestThreat(const Simulation& sim) {
+    point p = sim.getPlayer().getLoc();
+    const EntityStore& e = sim.getEntities();
+    int best = BOT_LOOKAHEAD + SIZE, threatX = -1;
+
+    for(int i = 0; i < e.getAICount(); i++) {
+        int ahead = p.y - e.getAIY()[i];
+        if(ahead > -SIZE && ahead < best && std::abs(e.getAIX()[i] - p.x) < SIZE + BOT_MARGIN) {
+            best = ahead;
+            threatX = e.getAIX()[i];
+        }
+    }
+    for(int i = 0; i < e.getObstacleCount(); i++) {
+        if(!e.getObstacleActive()[i]) continue;
+        int ahead = p.y - e.getObstacleY()[i];
+        int reach = SIZE / 2 + e.getObstacleSize()[i] / 2 + BOT_MARGIN;
+        if(ahead > -SIZE && ahead < best && std::abs(e.getObstacleX()[i] - p.x) < reach) {
+            best = ahead;
+            threatX = e.getObstacleX()[i];
+        }
+    }
+    return threatX;
+}
+
+static char botKey(const Simulation& sim) {
+    const PlayerCar& player = sim.getPlayer();
+    int threatX = nearestThreat(sim);
+    if(threatX >= 0) {
+        int x = player.getLoc().x;
+        bool roomLeft = x > ROAD_START + SIZE + ROAD_BOUNDARY_OFFSET;
+        bool roomRight = x < ROAD_END - SIZE - ROAD_BOUNDARY_OFFSET;
+        if(threatX >= x) return roomLeft ? LEFT_ARROW : RIGHT_ARROW;
+        return roomRight ? RIGHT_ARROW : LEFT_ARROW;
+    }
+    if(player.getSpeed() < BOT_TARGET_SPEED) return UP_ARROW;
+    if(player.getSpeed() > BOT_TARGET_SPEED) return DOWN_ARROW;
+    return 0;
+}
+
+// ONE RACE, NORMAL MODE, UNTIL IT ENDS OR HITS THE TICK CAP
+static GameResult playGame(uint64_t seed, const RaceParams& params, Policy policy, int tickCap) {
+    Simulation sim;
+    sim.reset(seed, false, params);
+    Driver driver(static_cast<unsigned>(seed));
+
+    GameResult result = { 0, 0, 1, OUTCOME_TIMEOUT };
+    int crashOutcome = OUTCOME_TIMEOUT;
+    for(int t = 0; t < tickCap; t++) {
+        char key = policy == POLICY_BOT ? botKey(sim) :
+                   policy == POLICY_CRUISE ? UP_ARROW : randomKey(driver);
+        TickEvents events = sim.step(makeTickInput(key, false));
+
+        if(events.crashed) {
+            crashOutcome = events.hitAI && events.hitObstacle ? OUTCOME_BOTH :
+                           events.hitAI ? OUTCOME_AI : OUTCOME_OBSTACLE;
+            result.score = events.crashScore;
+        }
+        if(events.over || events.won) {
+            result.outcome = events.won ? OUTCOME_WON : crashOutcome;
+            if(events.won) result.score = sim.getScore();
+            result.ticks = sim.getTick();
+            result.lap = sim.getLap();
+            return result;
+        }
+    }
+    result.ticks = sim.getTick();
+    result.score = sim.getScore();
+    result.lap = sim.getLap();
+    return result;
+}
+
+static int percentile(const std::vector<int>& sorted, int pct) {
+    return sorted[std::min(sorted.size() - 1, sorted.size() * pct / 100)];
+}
+
+static void usage() {
+    std::printf("usage: batch_sim [--games N] [--ticks N] [--threads N] [--seed N]\n"
+                "                 [--policy random|cruise|bot] [--sweep name=v1,v2,...]...\n"
+                "sweepable:");
+    for(int p = 0; p < PARAM_NAME_COUNT; p++) std::printf(" %s", PARAM_NAMES[p].name);
+    std::printf("\n");
+}
+
+static bool parseSweep(const char* arg, Sweep& sweep) {
+    const char* eq = std::strchr(arg, '=');
+    if(!eq) return false;
+    std::string name(arg, eq);
+    sweep.param = -1;
+    for(int p = 0; p < PARAM_NAME_COUNT; p++) {
+        if(name == PARAM_NAMES[p].name) sweep.param = p;
+    }
+    if(sweep.param < 0) return false;
+
+    for(const char* s = eq + 1; *s; ) {
+        char* end;
+        sweep.values.push_back(static_cast<int>(std::strtol(s, &end, 10)));
+        if(end == s) return false;
+        s = *end == ',' ? end + 1 : end;
+
+        // Out-of-range values are refused rather than run clamped
+        RaceParams params;
+        params.*PARAM_NAMES[sweep.param].field = sweep.values.back();
+        if(!params.inRange()) {
+            std::printf("%s=%d is out of range (spawn ranges from 1; delay, lookahead and budget from 0)\n",
+                        name.c_str(), sweep.values.back());
+            return false;
+        }
+    }
+    return !sweep.values.empty();
+}
+
+int main(int argc, char** argv) {
+    int games = BATCH_GAMES, tickCap = BATCH_TICK_CAP, threads = 0;
+    uint64_t baseSeed = 1;
+    Policy policy = POLICY_BOT;
+    std::vector<Sweep> sweeps;
+
+    for(int i = 1; i + 1 < argc; i += 2) {
+        const char* value = argv[i + 1];
+        if(std::strcmp(argv[i], "--games") == 0) games = std::max(1, std::atoi(value));
+        else if(std::strcmp(argv[i], "--ticks") == 0) tickCap = std::max(1, std::atoi(value));
+        else if(std::strcmp(argv[i], "--threads") == 0) threads = std::atoi(value);
+        else if(std::strcmp(argv[i], "--seed") == 0) baseSeed = std::strtoull(value, nullptr, 10);
+        else if(std::strcmp(argv[i], "--policy") == 0) {
+            if(std::strcmp(value, "random") == 0) policy = POLICY_RANDOM;
+            else if(std::strcmp(value, "cruise") == 0) policy = POLICY_CRUISE;
+            else if(std::strcmp(value, "bot") == 0) policy = POLICY_BOT;
+            else {
+                usage();
+                return 1;
+            }
+        }
+        else if(std::strcmp(argv[i], "--sweep") == 0) {
+            Sweep sweep;
+            if(!parseSweep(value, sweep)) {
+                usage();
+                return 1;
+            }
+            sweeps.push_back(sweep);
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if(argc % 2 == 0) {
+        usage();
+        return 1;
+    }
+
+    // GRID - every combination of the swept values, first sweep slowest
+    std::vector<RaceParams> grid(1);
+    for(const Sweep& sweep : sweeps) {
+        std::vector<RaceParams> next;
+        for(const RaceParams& base : grid) {
+            for(int v : sweep.values) {
+                next.push_back(base);
+                next.back().*PARAM_NAMES[sweep.param].field = v;
+            }
+        }
+        grid.swap(next);
+    }
+
+    // PLAY EVERY RACE - one task per race, results land in their own slot
+    const int configs = static_cast<int>(grid.size());
+    const int total = configs * games;
+    std::vector<GameResult> results(total);
+    ThreadPool pool(threads);
+    auto start = Clock::now();
+    pool.run(total, [&](int g) {
+        // Every grid point sees the same seeds, so columns compare like for like
+        results[g] = playGame(baseSeed + g % games, grid[g / games], policy, tickCap);
+    });
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // REPORT
+    static const char* POLICY_NAMES[] = { "random", "cruise", "bot" };
+    std::printf("%d configs x %d races, %s driver, tick cap %d, %d threads\n\n",
+                configs, games, POLICY_NAMES[policy], tickCap, pool.getThreadCount());
+    for(const Sweep& sweep : sweeps) std::printf("%10s ", PARAM_NAMES[sweep.param].name);
+    std::printf("| %9s | %7s %7s %7s %7s |", "survive s", "p10", "p50", "p90", "mean");
+    for(int lap = 1; lap <= MAX_LAPS; lap++) std::printf(" lap%d%%", lap);
+    std::printf(" |");
+    for(int o = 0; o < OUTCOME_COUNT; o++) std::printf(" %6s%%", OUTCOME_NAMES[o]);
+    std::printf("\n");
+
+    long long simulatedTicks = 0;
+    for(int c = 0; c < configs; c++) {
+        std::vector<int> scores(games);
+        long long ticks = 0, scoreSum = 0;
+        int laps[MAX_LAPS + 1] = { 0 }, outcomes[OUTCOME_COUNT] = { 0 };
+        for(int g = 0; g < games; g++) {
+            const GameResult& r = results[c * games + g];
+            scores[g] = r.score;
+            ticks += r.ticks;
+            scoreSum += r.score;
+            laps[std::max(1, std::min(r.lap, MAX_LAPS))]++;
+            outcomes[r.outcome]++;
+        }
+        simulatedTicks += ticks;
+        std::sort(scores.begin(), scores.end());
+
+        for(const Sweep& sweep : sweeps) std::printf("%10d ", grid[c].*PARAM_NAMES[sweep.param].field);
+        std::printf("| %9.1f | %7d %7d %7d %7lld |", static_cast<double>(ticks) / games / FPS_TARGET,
+                    percentile(scores, 10), percentile(scores, 50), percentile(scores, 90), scoreSum / games);
+        for(int lap = 1; lap <= MAX_LAPS; lap++) std::printf(" %5.1f", 100.0 * laps[lap] / games);
+        std::printf(" |");
+        for(int o = 0; o < OUTCOME_COUNT; o++) std::printf(" %7.1f", 100.0 * outcomes[o] / games);
+        std::printf("\n");
+    }
+
+    std::printf("\n%lld ticks in %.2f s = %.0f ticks/s (%.0f per thread), %.0fx real time\n",
+                simulatedTicks, seconds, simulatedTicks / seconds,
+                simulatedTicks / seconds / pool.getThreadCount(), simulatedTicks / seconds / FPS_TARGET);
+    return 0;
+}
@@ -0,0 +1,88 @@
+//================================================================
+// bench_ai.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: AI Scheduler Benchmark
+// Description: Per-tick AI update time (mean, 99th percentile and
+//              worst tick) and most lane decisions in one tick with
+//              every due car deciding at once, against the default
+//              per-tick decision budget, plus the longest any car went
+//              between decisions
+//================================================================
+
+#include "EntityStore.h"
+#include "Random.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <vector>
+
+const int BENCH_TICKS = 20000;        // Ticks timed per measurement, from the first
+const int BENCH_PLAYER_SPEED = 5;     // Obstacle scroll per tick
+
+typedef std::chrono::steady_clock Clock;
+
+struct TickTimes {
+    double meanUs, p99Us, worstUs;
+    int    mostDecisions;   // Lane decisions in the busiest tick
+    int    longestGap;      // Most ticks any car went between decisions
+};
+
+// TIME EACH TICK OF ONE STORE - every car added at once at one speed, so
+// their decisions and respawns line up the way a starting grid does
+static TickTimes run(int cars, int budget) {
+    Random random(2026);
+    RandomScope scope(random);
+    EntityStore store(cars, cars / 4 + 1);
+    RaceParams params;
+    params.aiDecisionBudget = budget;
+    store.setParams(params);
+    for(int i = 0; i < cars; i++) store.addAICar(-SIZE, AI_BLUE, 4);
+    for(int i = 0; i < cars / 4 + 1; i++) store.addObstacle(LANE_X[i % 3], -random.nextInt(COL));
+
+    std::vector<double> ticks;
+    ticks.reserve(BENCH_TICKS);
+    int mostDecisions = 0, longestGap = 0;
+    for(int t = 0; t < BENCH_TICKS; t++) {
+        auto start = Clock::now();
+        store.updateAICars();
+        ticks.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        store.updateObstacles(BENCH_PLAYER_SPEED);
+
+        // A restarted timer on a car that moved is a decision (respawns stand still)
+        int decisions = 0;
+        for(int i = 0; i < cars; i++) {
+            decisions += store.getAITimer()[i] == 0 && store.getAIPrvY()[i] != store.getAIY()[i];
+            longestGap = std::max(longestGap, store.getAITimer()[i]);
+        }
+        mostDecisions = std::max(mostDecisions, decisions);
+    }
+
+    std::sort(ticks.begin(), ticks.end());
+    double sum = 0;
+    for(double us : ticks) sum += us;
+    TickTimes times;
+    times.meanUs = sum / ticks.size();
+    times.p99Us = ticks[ticks.size() * 99 / 100];
+    times.worstUs = ticks.back();
+    times.mostDecisions = mostDecisions;
+    times.longestGap = longestGap;
+    return times;
+}
+
+int main() {
+    const int COUNTS[4] = { 8, 64, 512, 4096 };
+
+    std::printf("%6s | %42s | %42s\n", "", "every due car decides", "AI_DECISIONS_PER_TICK per tick");
+    std::printf("%6s | %7s %7s %8s %6s %9s | %7s %7s %8s %6s %9s\n", "cars", "mean us", "p99 us", "worst us",
+                "most", "max ticks", "mean us", "p99 us", "worst us", "most", "max ticks");
+    for(int c = 0; c < 4; c++) {
+        TickTimes all = run(COUNTS[c], INT_MAX);
+        TickTimes budgeted = run(COUNTS[c], AI_DECISIONS_PER_TICK);
+        std::printf("%6d | %7.2f %7.2f %8.2f %6d %9d | %7.2f %7.2f %8.2f %6d %9d\n", COUNTS[c],
+                    all.meanUs, all.p99Us, all.worstUs, all.mostDecisions, all.longestGap,
+                    budgeted.meanUs, budgeted.p99Us, budgeted.worstUs, budgeted.mostDecisions,
+                    budgeted.longestGap);
+    }
+    return 0;
+}
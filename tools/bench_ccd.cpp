@@ -0,0 +1,109 @@
+//================================================================
+// bench_ccd.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Swept Collision Benchmark
+// Description: Collisions found by end-of-tick and swept tests as the
+//              tick rate drops (motion per tick grows), the cost of each
+//              test, and the cost of one simulation tick
+//================================================================
+
+#include "Collision.h"
+#include "Simulation.h"
+#include <chrono>
+#include <cstdio>
+
+const int BENCH_ENCOUNTERS = 200000;  // Random player/entity encounters per rate
+const int BENCH_SUBSTEPS = 2048;      // Samples per tick for the reference answer
+const int BENCH_TICKS = 200000;       // Simulation ticks timed
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// REFERENCE - overlap sampled finely along the relative motion
+static bool sampledHit(bool circle, int dx, int dy, int vx, int vy, int reach) {
+    for(int s = 0; s <= BENCH_SUBSTEPS; s++) {
+        double t = static_cast<double>(s) / BENCH_SUBSTEPS;
+        double x = dx + t * vx, y = dy + t * vy;
+        if(circle ? x * x + y * y < reach * reach : (x > -reach && x < reach && y > -reach && y < reach)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main() {
+    const int RATES[4] = { 1, 2, 4, 8 };
+    Random random(2026);
+    RandomScope scope(random);
+
+    // ACCURACY - one encounter is a player and a car or cone over one tick;
+    // at 1/k of the tick rate everything moves k times farther per tick
+    std::printf("%6s %10s | %14s %14s | %12s %12s\n", "rate", "road px/tk",
+                "end-of-tick %", "swept %", "end ns", "swept ns");
+    for(int r = 0; r < 4; r++) {
+        const int k = RATES[r];
+        std::vector<point> from(BENCH_ENCOUNTERS), to(BENCH_ENCOUNTERS);
+        std::vector<int> x0(BENCH_ENCOUNTERS), y0(BENCH_ENCOUNTERS), x1(BENCH_ENCOUNTERS), y1(BENCH_ENCOUNTERS);
+        std::vector<int> sizes(BENCH_ENCOUNTERS);
+        std::vector<Uint8> active(BENCH_ENCOUNTERS, 1);
+        std::vector<Uint8> circle(BENCH_ENCOUNTERS), truth(BENCH_ENCOUNTERS);
+        int hits = 0;
+        for(int e = 0; e < BENCH_ENCOUNTERS; e++) {
+            int speed = MIN_SPEED + random.nextInt(MAX_SPEED - MIN_SPEED + 1);
+            circle[e] = random.nextInt(2);
+            sizes[e] = circle[e] ? SIZE : OBSTACLE_SIZE;
+            int fall = circle[e] ? 3 + random.nextInt(3) : speed;   // AI car speed or road scroll
+            int steer = (random.nextInt(3) - 1) * speed;
+            from[e] = point(0, 0);
+            to[e] = point(k * steer, 0);
+            x0[e] = random.nextInt(2 * (SIZE + k * MAX_SPEED)) - (SIZE + k * MAX_SPEED);
+            y0[e] = -random.nextInt(SIZE + k * (MAX_SPEED + 5)) + SIZE / 2;
+            x1[e] = x0[e];
+            y1[e] = y0[e] + k * fall;
+            int reach = SIZE / 2 + sizes[e] / 2;
+            truth[e] = sampledHit(circle[e] != 0, -x0[e], -y0[e], k * steer, -k * fall, reach);
+            hits += truth[e];
+        }
+
+        int endFound = 0, sweptFound = 0, wrong = 0;
+        auto start = Clock::now();
+        for(int e = 0; e < BENCH_ENCOUNTERS; e++) {
+            bool hit = circle[e] ? Collision::checkCircles(to[e], SIZE, &x1[e], &y1[e], &sizes[e], 1).first >= 0 :
+                                   Collision::checkBoxes(to[e], SIZE, &x1[e], &y1[e], &sizes[e], &active[e], 1).first >= 0;
+            endFound += hit && truth[e];
+        }
+        double endNs = elapsedNs(start) / BENCH_ENCOUNTERS;
+        start = Clock::now();
+        for(int e = 0; e < BENCH_ENCOUNTERS; e++) {
+            bool hit = circle[e] ?
+                Collision::checkSweptCircles(from[e], to[e], SIZE, &x0[e], &y0[e], &x1[e], &y1[e], &sizes[e], 1).first >= 0 :
+                Collision::checkSweptBoxes(from[e], to[e], SIZE, &x0[e], &y0[e], &x1[e], &y1[e], &sizes[e], &active[e], 1).first >= 0;
+            sweptFound += hit && truth[e];
+            wrong += hit != (truth[e] != 0);
+        }
+        double sweptNs = elapsedNs(start) / BENCH_ENCOUNTERS;
+
+        std::printf("  1/%-2d %10d | %14.2f %14.2f | %12.1f %12.1f%s\n", k, k * MAX_SPEED,
+                    100.0 * endFound / hits, 100.0 * sweptFound / hits, endNs, sweptNs,
+                    wrong ? "  (swept disagrees with sampling)" : "");
+    }
+
+    // TICK COST - what a lower tick rate saves per simulated second
+    Simulation sim;
+    sim.reset(1, true);
+    unsigned keys = 7919;
+    auto start = Clock::now();
+    for(int t = 0; t < BENCH_TICKS; t++) {
+        keys = keys * 1103515245u + 12345u;
+        int k = (keys >> 16) % 10;
+        TickEvents events = sim.step(makeTickInput(k < 4 ? static_cast<char>(k + 1) : 0, true));
+        if(events.over) sim.reset(t, true);
+    }
+    double tickNs = elapsedNs(start) / BENCH_TICKS;
+    std::printf("\nsimulation step %.0f ns = %.1f us per second of play at %d ticks/s, %.1f us at 1/2\n",
+                tickNs, tickNs * FPS_TARGET / 1000.0, FPS_TARGET, tickNs * FPS_TARGET / 2000.0);
+    return 0;
+}
@@ -0,0 +1,49 @@
+//================================================================
+// bench_entities.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Entity Update Benchmark
+// Description: Times EntityStore AI car and obstacle updates per
+//              entity at small, medium, and large entity counts
+//================================================================
+
+#include "EntityStore.h"
+#include "Random.h"
+#include <chrono>
+#include <cstdio>
+
+const int BENCH_UPDATES = 20000000;   // Entity updates timed per measurement
+const int BENCH_OBSTACLES = 3;        // Obstacles the AI cars steer around
+
+// NANOSECONDS PER ENTITY FOR ONE KIND OF UPDATE
+template <typename Update>
+static double timePerEntity(int entities, Update update) {
+    int ticks = BENCH_UPDATES / entities;
+    auto start = std::chrono::steady_clock::now();
+    for(int t = 0; t < ticks; t++) update();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(ticks) * entities);
+}
+
+int main() {
+    const int COUNTS[3] = { 10, 1000, 100000 };
+    Random random(2026);
+    RandomScope scope(random);
+
+    std::printf("%10s %14s %14s\n", "entities", "ai ns/car", "obstacle ns/obj");
+    for(int c = 0; c < 3; c++) {
+        const int n = COUNTS[c];
+
+        // AI CARS SPREAD DOWN THE ROAD, A FEW CONES TO STEER AROUND
+        EntityStore cars(n, BENCH_OBSTACLES);
+        for(int i = 0; i < n; i++) cars.addAICar(-random.nextInt(COL), AI_BLUE, 3 + i % 3);
+        for(int i = 0; i < BENCH_OBSTACLES; i++) cars.addObstacle(LANE_X[i], -100 * (i + 1));
+        double aiNs = timePerEntity(n, [&]{ cars.updateAICars(); });
+
+        EntityStore cones(0, n);
+        for(int i = 0; i < n; i++) cones.addObstacle(ROAD_START + random.nextInt(ROAD_WIDTH), -random.nextInt(COL));
+        double obstacleNs = timePerEntity(n, [&]{ cones.updateObstacles(5); });
+
+        std::printf("%10d %14.2f %14.2f\n", n, aiNs, obstacleNs);
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+//================================================================
+// bench_env.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Training Environment Benchmark
+// Description: Environment steps per second for both observation
+//              modes across environment counts, with random actions,
+//              and heap allocations made while stepping (should be 0)
+//================================================================
+
+#include "RaceEnv.h"
+#include "AllocCounter.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+const int BENCH_STEPS = 2000000;            // Environment steps timed per measurement
+const int BENCH_WARMUP = FPS_TARGET * 10;   // Lockstep ticks before timing (first crashes fill mask caches)
+
+typedef std::chrono::steady_clock Clock;
+
+int main(int argc, char** argv) {
+    const int COUNTS[4] = { 1, 64, 1024, 8192 };
+    const char* MODE_NAMES[2] = { "entities", "frame" };
+    int threads = 0;
+    if(argc == 3 && std::strcmp(argv[1], "--threads") == 0) threads = std::atoi(argv[2]);
+
+    std::printf("%8s %6s | %12s %10s | %9s %11s | %s\n", "mode", "envs", "steps/s", "ns/step",
+                "episodes", "reward/ep", "allocations");
+    for(int m = 0; m < 2; m++) {
+        for(int c = 0; c < 4; c++) {
+            const int n = COUNTS[c];
+            RaceEnv env(n, static_cast<ObservationMode>(m), threads);
+            std::vector<Uint8> actions(n);
+            unsigned keys = 7919;
+
+            env.reset(1);
+            const int rounds = std::max(1, BENCH_STEPS / n);
+            long episodes = 0;
+            double reward = 0;
+            long before = 0;
+            auto start = Clock::now();
+            for(int r = -BENCH_WARMUP; r < rounds; r++) {
+                if(r == 0) {
+                    episodes = 0;
+                    reward = 0;
+                    before = allocations;
+                    start = Clock::now();
+                }
+                for(int i = 0; i < n; i++) {
+                    keys = keys * 1103515245u + 12345u;
+                    actions[i] = static_cast<Uint8>((keys >> 16) % 5);
+                }
+                env.step(actions.data());
+                for(int i = 0; i < n; i++) {
+                    episodes += env.getDones()[i];
+                    reward += env.getRewards()[i];
+                }
+            }
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            long allocated = allocations - before;
+
+            double steps = static_cast<double>(rounds) * n;
+            std::printf("%8s %6d | %12.0f %10.1f | %9ld %11.1f | %ld\n", MODE_NAMES[m], n,
+                        steps / seconds, seconds * 1e9 / steps, episodes,
+                        episodes ? reward / episodes : 0.0, allocated);
+        }
+    }
+
+    RaceEnv env(1, OBSERVE_ENTITIES, threads);
+    std::printf("\n%d threads, %d floats per entity observation, %dx%d cells per frame\n",
+                env.getThreadCount(), ENV_OBSERVATION_SIZE, ENV_FRAME_WIDTH, ENV_FRAME_HEIGHT);
+    return 0;
+}
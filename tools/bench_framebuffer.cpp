@@ -0,0 +1,71 @@
+//================================================================
+// bench_framebuffer.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Framebuffer Layout Benchmark
+// Description: Times a sprite-and-text frame in row-major and tiled
+//              draw buffer layouts across resolutions and entity counts
+//================================================================
+
+#include "SDL_Plotter.h"
+#include "Utils.h"
+#include "Font.h"
+#include <chrono>
+#include <cstdio>
+
+const int BENCH_FRAMES = 40;
+
+// FIXED-SEED POSITIONS SO BOTH LAYOUTS DRAW THE SAME FRAME
+static unsigned int nextRandom(unsigned int& state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+// ONE FRAME: ROAD, CAR SPRITES, A LABEL PER FOUR CARS, PRESENT
+static void drawFrame(SDL_Plotter& g, int width, int height, int entities, int frame) {
+    unsigned int seed = 12345u;
+    g.clear();
+    g.fillRect(0, 0, width, height, GRASS);
+    g.fillRect(width / 4, 0, width / 2, height, ROAD);
+
+    for(int i = 0; i < entities; i++) {
+        int x = static_cast<int>(nextRandom(seed) % width);
+        int y = static_cast<int>((nextRandom(seed) + frame * 3) % height);
+        int wheel = SIZE / 5 + 2;
+        drawRect(x - SIZE / 2, y - SIZE / 2, SIZE, SIZE, AI_BLUE, g);
+        drawRect(x - SIZE / 2, y - SIZE / 2, wheel, wheel, BLACK, g);
+        drawRect(x + SIZE / 2 - wheel, y - SIZE / 2, wheel, wheel, BLACK, g);
+        drawRect(x - SIZE / 2, y + SIZE / 2 - wheel, wheel, wheel, BLACK, g);
+        drawRect(x + SIZE / 2 - wheel, y + SIZE / 2 - wheel, wheel, wheel, BLACK, g);
+        if(i % 4 == 0) FontRenderer::drawSmall(g, x - 20, y - SIZE, WHITE2, "CAR", 0);
+    }
+    g.update();
+}
+
+static double timeLayout(int width, int height, int entities, bool tiled) {
+    SDL_Plotter g(height, width, false);
+    g.setTiledLayout(tiled);
+    drawFrame(g, width, height, entities, 0);  // Warm caches
+
+    auto start = std::chrono::steady_clock::now();
+    for(int f = 0; f < BENCH_FRAMES; f++) {
+        drawFrame(g, width, height, entities, f);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / BENCH_FRAMES;
+}
+
+int main() {
+    const int sizes[][2] = { { 600, 600 }, { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+    const int counts[] = { 10, 100, 1000, 10000 };
+
+    printf("%-11s %8s %12s %12s %8s\n", "resolution", "entities", "row-major", "tiled", "speedup");
+    for(const auto& size : sizes) {
+        for(int entities : counts) {
+            double linear = timeLayout(size[0], size[1], entities, false);
+            double tiled = timeLayout(size[0], size[1], entities, true);
+            printf("%5dx%-5d %8d %9.3f ms %9.3f ms %7.2fx\n", size[0], size[1], entities,
+                   linear, tiled, linear / tiled);
+        }
+    }
+    return 0;
+}
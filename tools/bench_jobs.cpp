@@ -0,0 +1,162 @@
+//================================================================
+// bench_jobs.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Job System Benchmark
+// Description: Simulation step time on the calling thread against the
+//              job system at 2, 4 and every hardware thread, from the
+//              stock race to 32,768 extra cars and cones, then a sweep
+//              of the parallel threshold and range grain that suggests
+//              JOB_PARALLEL_ENTITIES and JOB_GRAIN_ENTITIES for this
+//              machine; every tick's state and events are checked
+//              against the single-threaded run
+//================================================================
+
+#include "Simulation.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+const int BENCH_TICKS = 1000;    // Ticks stepped per measurement
+const int BENCH_SEED = 2026;
+const double BENCH_MIN_SPEEDUP = 1.05;   // Speedup a size needs to count as worth splitting
+
+typedef std::chrono::steady_clock Clock;
+
+// FNV-1a OF ONE SAVED STATE
+static uint64_t hashState(const std::vector<Uint8>& state) {
+    uint64_t hash = 14695981039346656037ULL;
+    for(Uint8 byte : state) hash = (hash ^ byte) * 1099511628211ULL;
+    return hash;
+}
+
+// ONE RUN - microseconds per tick the world moved (crash freezes skipped),
+// plus a hash of the state and events after every tick (a lost race
+// restarts on the next seed) and the entities on the road at the start
+static double run(int traffic, JobSystem* jobs, std::vector<uint64_t>& hashes, int& entities) {
+    Simulation sim(3 + traffic, 3 + traffic);
+    RaceParams params;
+    params.startTraffic = traffic;
+    sim.setJobs(jobs);
+    sim.reset(BENCH_SEED, true, params);
+    entities = sim.getEntities().getAICount() + sim.getEntities().getObstacleCount();
+
+    std::vector<Uint8> state;
+    hashes.clear();
+    unsigned keys = 7919;
+    double us = 0;
+    int moving = 0;
+    for(int t = 0; t < BENCH_TICKS; t++) {
+        keys = keys * 1103515245u + 12345u;
+        int k = (keys >> 16) % 10;
+        auto start = Clock::now();
+        TickEvents events = sim.step(makeTickInput(k < 4 ? static_cast<char>(k + 1) : 0, true));
+        if(!events.frozen) {
+            us += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            moving++;
+        }
+
+        state.clear();
+        sim.saveState(state);
+        uint64_t eventBits = events.skid | events.frozen << 1 | events.crashed << 2 | events.hitAI << 3 |
+                             events.hitObstacle << 4 | events.over << 5 | events.won << 6;
+        hashes.push_back(hashState(state) ^ (eventBits << 56) ^ static_cast<uint64_t>(events.contact.x) << 40 ^
+                         static_cast<uint64_t>(events.contact.y) << 24);
+        if(events.over) sim.reset(sim.getSeed() + 1, true, params);
+    }
+    return us / std::max(moving, 1);
+}
+
+static long countMismatches(const std::vector<uint64_t>& expected, const std::vector<uint64_t>& actual) {
+    long mismatches = 0;
+    for(int t = 0; t < BENCH_TICKS; t++) mismatches += actual[t] != expected[t];
+    return mismatches;
+}
+
+int main() {
+    const int TRAFFIC[4] = { 0, 2048, 8192, 32768 };
+    const int SWEEP_TRAFFIC[6] = { 128, 256, 512, 1024, 2048, 8192 };
+    const int GRAINS[5] = { 64, 128, 256, 512, 1024 };
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    std::vector<int> threads = { 2, 4 };
+    if(hardware > 4) threads.push_back(hardware);
+    if(hardware < 2) {
+        std::printf("only one hardware thread: the threaded columns time-slice one core, so they\n"
+                    "show job system overhead, not scaling; run on a multi-core host to tune\n\n");
+    }
+
+    // SCALING - default tuning at each thread count
+    std::printf("hardware threads: %d\n\n%8s %9s | %12s", hardware, "extra", "entities", "1 thread us");
+    for(int n : threads) std::printf(" | %5d thr us  speedup", n);
+    std::printf(" | mismatched ticks\n");
+
+    std::vector<uint64_t> expected, actual;
+    long totalMismatches = 0;
+    int entities = 0;
+    for(int c = 0; c < 4; c++) {
+        run(TRAFFIC[c], nullptr, expected, entities);   // Warm up the allocator and caches
+        double serialUs = run(TRAFFIC[c], nullptr, expected, entities);
+        std::printf("%8d %9d | %12.1f", TRAFFIC[c], entities, serialUs);
+        long mismatches = 0;
+        for(int n : threads) {
+            JobSystem jobs(n);
+            double us = run(TRAFFIC[c], &jobs, actual, entities);
+            mismatches += countMismatches(expected, actual);
+            std::printf(" | %12.1f %7.2fx", us, serialUs / us);
+        }
+        std::printf(" | %ld\n", mismatches);
+        totalMismatches += mismatches;
+    }
+
+    // TUNING - every size split at every grain on all hardware threads;
+    // the grain with the best mean speedup wins, and the threshold is the
+    // smallest size from which that grain always pays
+    const int sweepThreads = std::max(hardware, 2);
+    JobSystem jobs(sweepThreads);
+    std::printf("\nspeedup over 1 thread, always split, %d threads\n\n%8s %9s | %12s", sweepThreads,
+                "extra", "entities", "1 thread us");
+    for(int grain : GRAINS) std::printf(" | grain %4d", grain);
+    std::printf("\n");
+
+    double speedup[6][5];
+    int sizes[6];
+    for(int c = 0; c < 6; c++) {
+        run(SWEEP_TRAFFIC[c], nullptr, expected, sizes[c]);
+        double serialUs = run(SWEEP_TRAFFIC[c], nullptr, expected, sizes[c]);
+        std::printf("%8d %9d | %12.1f", SWEEP_TRAFFIC[c], sizes[c], serialUs);
+        for(int g = 0; g < 5; g++) {
+            jobs.setTuning(0, GRAINS[g]);
+            speedup[c][g] = serialUs / run(SWEEP_TRAFFIC[c], &jobs, actual, entities);
+            totalMismatches += countMismatches(expected, actual);
+            std::printf(" | %9.2fx", speedup[c][g]);
+        }
+        std::printf("\n");
+    }
+
+    int best = 0;
+    double bestMean = 0;
+    for(int g = 0; g < 5; g++) {
+        double logSum = 0;
+        for(int c = 0; c < 6; c++) logSum += std::log(speedup[c][g]);
+        if(g == 0 || logSum / 6 > bestMean) {
+            best = g;
+            bestMean = logSum / 6;
+        }
+    }
+    int threshold = -1;
+    for(int c = 5; c >= 0 && speedup[c][best] >= BENCH_MIN_SPEEDUP; c--) threshold = sizes[c];
+
+    std::printf("\nmismatched ticks: %ld\n", totalMismatches);
+    if(hardware < 2) {
+        std::printf("no suggestion: one hardware thread\n");
+    } else if(threshold < 0) {
+        std::printf("suggested: no size gains %.2fx; keep the job system off on this machine\n",
+                    BENCH_MIN_SPEEDUP);
+    } else {
+        std::printf("suggested: JOB_PARALLEL_ENTITIES = %d, JOB_GRAIN_ENTITIES = %d\n",
+                    threshold, GRAINS[best]);
+    }
+    return totalMismatches ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+//================================================================
+// bench_particles.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Particle System Benchmark
+// Description: Update and draw time per frame for opaque and additive
+//              particle pools held at 10,000, 30,000 and
+//              PARTICLE_CAPACITY live particles on one thread, and heap
+//              allocations made after startup (should be 0)
+//================================================================
+
+#include "Particles.h"
+#include "AllocCounter.h"
+#include <chrono>
+#include <cstdio>
+
+const int BENCH_FRAMES = 500;          // Frames timed per measurement
+const int BENCH_WARMUP_FRAMES = 50;    // Frames before timing
+const int BENCH_LIFE = 400;            // Particle life in frames (long, so refills stay small)
+const double BENCH_BUDGET_MS = 2.0;    // Update plus draw target per frame
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// TOP UP - bursts across the screen until the pool holds count particles
+static void refill(ParticleSystem& particles, int count, unsigned& seed) {
+    while(particles.getLiveCount() < count) {
+        seed = seed * 1664525u + 1013904223u;
+        float x = static_cast<float>(seed >> 8 & 0xFFFF) * ROW / 65536.0f;
+        float y = static_cast<float>(seed >> 16 & 0xFFFF) * COL / 65536.0f;
+        int burst = count - particles.getLiveCount();
+        particles.emitBurst(x, y, burst < 64 ? burst : 64, 2.0f, BENCH_LIFE, SPARK);
+    }
+}
+
+int main() {
+    const int COUNTS[3] = { 10000, 30000, PARTICLE_CAPACITY };
+    const char* BLEND_NAMES[2] = { "opaque", "additive" };
+
+    SDL_Plotter g(ROW, COL, false);
+    ParticleSystem pools[2] = { ParticleSystem(PARTICLE_CAPACITY, BLEND_OPAQUE, 2),
+                                ParticleSystem(PARTICLE_CAPACITY, BLEND_ADDITIVE, 2) };
+
+    std::printf("%9s %8s | %10s %10s %10s | %6s | %s\n", "blend", "live", "update ms", "draw ms",
+                "frame ms", "< 2 ms", "allocations");
+    for(int b = 0; b < 2; b++) {
+        for(int c = 0; c < 3; c++) {
+            ParticleSystem& particles = pools[b];
+            unsigned seed = 2026;
+            particles.clear();
+
+            double updateMs = 0, drawMs = 0;
+            long before = allocations;
+            for(int frame = -BENCH_WARMUP_FRAMES; frame < BENCH_FRAMES; frame++) {
+                if(frame == 0) {
+                    updateMs = drawMs = 0;
+                    before = allocations;
+                }
+                refill(particles, COUNTS[c], seed);
+                g.clear();
+
+                auto start = Clock::now();
+                particles.update(1.0f);
+                updateMs += elapsedMs(start);
+
+                start = Clock::now();
+                particles.draw(g);
+                drawMs += elapsedMs(start);
+            }
+            long allocated = allocations - before;
+
+            updateMs /= BENCH_FRAMES;
+            drawMs /= BENCH_FRAMES;
+            std::printf("%9s %8d | %10.3f %10.3f %10.3f | %6s | %ld\n", BLEND_NAMES[b], COUNTS[c],
+                        updateMs, drawMs, updateMs + drawMs,
+                        updateMs + drawMs < BENCH_BUDGET_MS ? "yes" : "no", allocated);
+        }
+    }
+    return 0;
+}
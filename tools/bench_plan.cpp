@@ -0,0 +1,150 @@
+//================================================================
+// bench_plan.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: AI Planning Benchmark
+// Description: Whole AI update cost per lane decision (occupancy
+//              table build included) with every car deciding each tick,
+//              from 8 to 4,096 cars, against checking every other
+//              entity per decision, and how often AI cars overlap each
+//              other or cones in an hour of full traffic
+//================================================================
+
+#include "Simulation.h"
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const int BENCH_TICKS = 2000;                       // Ticks timed per planning measurement
+const int BENCH_TRAFFIC_TICKS = FPS_TARGET * 60 * 60;   // An hour of full traffic for the overlap rates
+const int BENCH_CRUISE_SPEED = 8;                   // Road scroll while measuring overlaps
+const int BENCH_PLAYER_SPEED = 5;                   // Obstacle scroll per tick while planning
+
+typedef std::chrono::steady_clock Clock;
+
+// STORE WITH CARS AT ONE PLACE EACH AND A CONE PER FOUR CARS
+static void fill(EntityStore& store, int cars) {
+    Random random(2026);
+    RandomScope scope(random);
+    RaceParams params;
+    params.laneChangeDelay = 0;
+    params.aiDecisionBudget = INT_MAX;
+    store.setParams(params);
+    for(int i = 0; i < cars; i++) store.addAICar(-random.nextInt(COL), AI_BLUE, 3 + i % 3);
+    for(int i = 0; i < cars / 4 + 1; i++) {
+        store.addObstacle(ROAD_START + random.nextInt(ROAD_WIDTH), -random.nextInt(COL));
+    }
+}
+
+// MICROSECONDS PER TICK, AND DECISIONS MADE (a restarted timer on a car
+// that moved; respawns stand still)
+static double timeTicks(EntityStore& store, long& decisions) {
+    decisions = 0;
+    double us = 0;
+    for(int t = 0; t < BENCH_TICKS; t++) {
+        auto start = Clock::now();
+        store.updateAICars();
+        us += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        store.updateObstacles(BENCH_PLAYER_SPEED);
+        for(int i = 0; i < store.getAICount(); i++) {
+            decisions += store.getAITimer()[i] == 0 && store.getAIPrvY()[i] != store.getAIY()[i];
+        }
+    }
+    return us;
+}
+
+// PAIRWISE PLANNING - each car tests every lane against every other car
+// and cone over the same steps the occupancy table predicts, as a
+// decision would without the table
+static bool sweptOverlap(int y0, int v0, int half0, int y1, int v1, int half1, int step) {
+    int a0 = y0 + v0 * step * OCCUPANCY_STEP_TICKS, a1 = a0 + v0 * OCCUPANCY_STEP_TICKS;
+    int b0 = y1 + v1 * step * OCCUPANCY_STEP_TICKS, b1 = b0 + v1 * OCCUPANCY_STEP_TICKS;
+    return std::min(a0, a1) - half0 <= std::max(b0, b1) + half1 && std::min(b0, b1) - half1 <= std::max(a0, a1) + half0;
+}
+
+static long pairwisePlan(const EntityStore& store) {
+    long open = 0;
+    const int* y = store.getAIY();
+    const int* speed = store.getAISpeed();
+    const int* lane = store.getAILane();
+    for(int i = 0; i < store.getAICount(); i++) {
+        for(int l = LEFT_LANE; l <= RIGHT_LANE; l++) {
+            bool clear = true;
+            for(int j = 0; j < store.getAICount(); j++) {
+                if(j == i || lane[j] != l) continue;
+                for(int s = 0; s < OCCUPANCY_STEPS; s++) clear &= !sweptOverlap(y[i], speed[i], SIZE / 2, y[j], speed[j], SIZE / 2, s);
+            }
+            for(int j = 0; j < store.getObstacleCount(); j++) {
+                int size = store.getObstacleSize()[j];
+                if(std::abs(store.getObstacleX()[j] - LANE_X[l]) > (SIZE + size) / 2) continue;
+                for(int s = 0; s < OCCUPANCY_STEPS; s++) {
+                    clear &= !sweptOverlap(y[i], speed[i], SIZE / 2, store.getObstacleY()[j], BENCH_PLAYER_SPEED, size / 2, s);
+                }
+            }
+            open += clear;
+        }
+    }
+    return open;
+}
+
+int main() {
+    const int COUNTS[4] = { 8, 64, 512, 4096 };
+
+    std::printf("%6s | %11s | %12s | %15s | %s\n", "cars", "decisions/t", "tick ns/dec", "pairwise ns/dec",
+                "open lanes/car");
+    for(int c = 0; c < 4; c++) {
+        const int n = COUNTS[c];
+        long decisions;
+        EntityStore planning(n, n / 4 + 1);
+        fill(planning, n);
+        double planUs = timeTicks(planning, decisions);
+
+        int rounds = std::max(1, 200000 / (n * n));
+        long open = 0;
+        auto start = Clock::now();
+        for(int r = 0; r < rounds; r++) open += pairwisePlan(planning);
+        double pairNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (static_cast<double>(rounds) * n);
+
+        std::printf("%6d | %11.1f | %12.1f | %15.1f | %.2f\n", n, static_cast<double>(decisions) / BENCH_TICKS,
+                    planUs * 1000.0 / std::max(decisions, 1L), pairNs,
+                    static_cast<double>(open) / (static_cast<double>(rounds) * n));
+    }
+
+    // FULL TRAFFIC - both pools full, the road scrolling at cruising speed;
+    // overlaps of on-screen cars counted per minute
+    EntityStore traffic;
+    traffic.seed(7000);
+    static const color COLORS[3] = { AI_BLUE, AI_GREEN, AI_YELLOW };
+    for(int i = 0; i < traffic.getAICapacity(); i++) {
+        traffic.respawnAICar(traffic.findAICar(traffic.addAICar(0, COLORS[i % 3], 3 + i % 3)));
+    }
+    for(int i = 0; i < traffic.getObstacleCapacity(); i++) traffic.respawnObstacle(traffic.findObstacle(traffic.addObstacle(0, 0)));
+
+    long carOverlaps = 0, coneOverlaps = 0, changes = 0;
+    std::vector<int> lanes(traffic.getAILane(), traffic.getAILane() + traffic.getAICount());
+    for(int t = 0; t < BENCH_TRAFFIC_TICKS; t++) {
+        traffic.updateAICars();
+        traffic.updateObstacles(BENCH_CRUISE_SPEED);
+        const int* x = traffic.getAIX();
+        const int* y = traffic.getAIY();
+        for(int i = 0; i < traffic.getAICount(); i++) {
+            changes += traffic.getAILane()[i] != lanes[i] && y[i] >= 0;   // Not a respawn
+            lanes[i] = traffic.getAILane()[i];
+            if(y[i] < 0 || y[i] > COL) continue;   // On screen only
+            for(int j = i + 1; j < traffic.getAICount(); j++) {
+                carOverlaps += std::abs(x[i] - x[j]) < SIZE && std::abs(y[i] - y[j]) < SIZE;
+            }
+            for(int j = 0; j < traffic.getObstacleCount(); j++) {
+                int reach = (SIZE + traffic.getObstacleSize()[j]) / 2;
+                coneOverlaps += std::abs(x[i] - traffic.getObstacleX()[j]) < reach &&
+                                std::abs(y[i] - traffic.getObstacleY()[j]) < reach;
+            }
+        }
+    }
+    double minutes = BENCH_TRAFFIC_TICKS / (FPS_TARGET * 60.0);
+    std::printf("\n%d cars, %d cones, %.0f minutes: per minute %.1f lane changes, %.1f car-car and %.1f car-cone "
+                "overlap ticks\n", traffic.getAICount(), traffic.getObstacleCount(), minutes, changes / minutes,
+                carOverlaps / minutes, coneOverlaps / minutes);
+    return 0;
+}
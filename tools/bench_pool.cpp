@@ -0,0 +1,160 @@
+//================================================================
+// bench_pool.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Entity Pool Benchmark
+// Description: Spawn and remove cost with random churn at several pool
+//              sizes, stale handle detection, AI update cost after
+//              churn against a freshly filled store, and heap
+//              allocations during churn and ramping races (should be 0)
+//================================================================
+
+#include "Simulation.h"
+#include "AllocCounter.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+const int BENCH_CHURN_OPS = 4000000;      // Spawns plus removals (at least) timed per pool size
+const int BENCH_UPDATES = 5000000;        // Car updates timed per update measurement
+const int BENCH_RACES = 50;               // Ramping races checked for allocations
+const int BENCH_WARMUP_RACES = 5;         // Races before counting (first crashes fill mask caches)
+const int BENCH_RACE_TICKS = FPS_TARGET * 60 * 10;
+const int BENCH_SPARSE_SPAWN = 4000;      // Spawn range that lets the dodging driver live through many laps
+const int BENCH_LOOKAHEAD = SIZE * 4;     // Pixels ahead the dodging driver watches
+
+typedef std::chrono::steady_clock Clock;
+
+static double nsPerCarUpdate(EntityStore& store) {
+    int ticks = BENCH_UPDATES / store.getAICount();
+    auto start = Clock::now();
+    for(int t = 0; t < ticks; t++) store.updateAICars();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+           (static_cast<double>(ticks) * store.getAICount());
+}
+
+// DODGING DRIVER - steer away from the nearest thing ahead in the
+// player's column, otherwise speed up
+static char dodgeKey(const Simulation& sim) {
+    point p = sim.getPlayer().getLoc();
+    const EntityStore& e = sim.getEntities();
+    int best = BENCH_LOOKAHEAD, threatX = -1;
+    for(int i = 0; i < e.getAICount(); i++) {
+        int ahead = p.y - e.getAIY()[i];
+        if(ahead > -SIZE && ahead < best && std::abs(e.getAIX()[i] - p.x) < SIZE + 6) {
+            best = ahead;
+            threatX = e.getAIX()[i];
+        }
+    }
+    for(int i = 0; i < e.getObstacleCount(); i++) {
+        int ahead = p.y - e.getObstacleY()[i];
+        if(ahead > -SIZE && ahead < best && std::abs(e.getObstacleX()[i] - p.x) < SIZE / 2 + e.getObstacleSize()[i] / 2 + 6) {
+            best = ahead;
+            threatX = e.getObstacleX()[i];
+        }
+    }
+    if(threatX < 0) return UP_ARROW;
+    bool roomLeft = p.x > ROAD_START + SIZE + ROAD_BOUNDARY_OFFSET;
+    bool roomRight = p.x < ROAD_END - SIZE - ROAD_BOUNDARY_OFFSET;
+    if(threatX >= p.x) return roomLeft ? LEFT_ARROW : RIGHT_ARROW;
+    return roomRight ? RIGHT_ARROW : LEFT_ARROW;
+}
+
+int main() {
+    const int CAPACITIES[3] = { 64, 1024, 8192 };
+    Random random(2026);
+    RandomScope scope(random);
+
+    std::printf("%8s | %9s %9s | %6s %6s | %12s %12s | %s\n", "capacity", "spawn ns", "remove ns",
+                "stale", "wrong", "fresh ns/car", "churn ns/car", "allocations");
+    for(int c = 0; c < 3; c++) {
+        const int capacity = CAPACITIES[c];
+        EntityStore store(capacity, 0);
+        std::vector<EntityHandle> live, removed;
+        std::vector<unsigned> ids;   // Each car's id, kept in its color, to check handles find the right car
+        live.reserve(capacity);
+        ids.reserve(capacity);
+        removed.reserve(BENCH_CHURN_OPS + capacity);
+
+        unsigned nextId = 0;
+        for(int i = 0; i < capacity / 2; i++) {
+            live.push_back(store.addAICar(-random.nextInt(COL), color(nextId, 0, 0)));
+            ids.push_back(nextId++);
+        }
+        double freshNs = nsPerCarUpdate(store);
+
+        // CHURN - rounds of removing random cars down to a quarter full,
+        // then spawning back to three quarters
+        long before = allocations;
+        double spawnNs = 0, removeNs = 0;
+        long spawns = 0, removals = 0;
+        while(spawns + removals < BENCH_CHURN_OPS) {
+            auto start = Clock::now();
+            long count = 0;
+            while(static_cast<int>(live.size()) > capacity / 4) {
+                int pick = random.nextInt(static_cast<int>(live.size()));
+                store.removeAICar(live[pick]);
+                removed.push_back(live[pick]);
+                live[pick] = live.back();
+                ids[pick] = ids.back();
+                live.pop_back();
+                ids.pop_back();
+                count++;
+            }
+            removeNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            removals += count;
+
+            start = Clock::now();
+            count = 0;
+            while(static_cast<int>(live.size()) < capacity * 3 / 4) {
+                live.push_back(store.addAICar(-random.nextInt(COL), color(nextId, 0, 0)));
+                ids.push_back(nextId++);
+                count++;
+            }
+            spawnNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            spawns += count;
+        }
+        long allocated = allocations - before;
+
+        // BACK TO HALF FULL, SO THE UPDATE TIMES COMPARE THE SAME COUNT
+        while(static_cast<int>(live.size()) > capacity / 2) {
+            store.removeAICar(live.back());
+            removed.push_back(live.back());
+            live.pop_back();
+            ids.pop_back();
+        }
+
+        // HANDLES - removed ones stale, live ones find their own car
+        long stale = 0, wrong = 0;
+        for(const EntityHandle& h : removed) stale += store.findAICar(h) < 0;
+        for(size_t i = 0; i < live.size(); i++) {
+            int index = store.findAICar(live[i]);
+            wrong += index < 0 || store.getAIColor(index).R != ids[i];
+        }
+        double churnNs = nsPerCarUpdate(store);
+
+        std::printf("%8d | %9.1f %9.1f | %5.1f%% %6ld | %12.2f %12.2f | %ld\n", capacity,
+                    spawnNs / spawns, removeNs / removals, 100.0 * stale / removed.size(), wrong,
+                    freshNs, churnNs, allocated);
+    }
+
+    // RAMPING RACES - traffic grows each lap; nothing may allocate after reset
+    Simulation sim;
+    RaceParams sparse;
+    sparse.aiSpawnRange = sparse.obstacleSpawnRange = BENCH_SPARSE_SPAWN;
+    long before = allocations;
+    int peakCars = 0, peakObstacles = 0;
+    for(int race = 0; race < BENCH_RACES; race++) {
+        if(race == BENCH_WARMUP_RACES) before = allocations;
+        sim.reset(5000 + race, true, sparse);
+        for(int t = 0; t < BENCH_RACE_TICKS; t++) {
+            // A lost race restarts on the next seed
+            if(sim.step(makeTickInput(dodgeKey(sim), true)).over) sim.reset(sim.getSeed() + BENCH_RACES, true, sparse);
+            peakCars = std::max(peakCars, sim.getEntities().getAICount());
+            peakObstacles = std::max(peakObstacles, sim.getEntities().getObstacleCount());
+        }
+    }
+    std::printf("\n%d ramping races: peak %d/%d cars, %d/%d obstacles, %ld allocations after %d warm-up races\n",
+                BENCH_RACES, peakCars, MAX_AI_CARS, peakObstacles, MAX_OBSTACLES, allocations - before,
+                BENCH_WARMUP_RACES);
+    return 0;
+}
@@ -0,0 +1,120 @@
+//================================================================
+// bench_seek.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Replay Seek Benchmark
+// Description: Records infinite-mode sessions of 10 minutes to 4 hours
+//              with keyframes, then times opening them and seeking to
+//              random ticks against re-simulating from tick zero, and
+//              checks every seek lands on the re-simulated state
+//================================================================
+
+#include "SessionFile.h"
+#include "SessionWriter.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+const int BENCH_SEEKS = 200;         // Random seeks timed per session
+const int BENCH_FULL_REPLAYS = 3;    // From-zero replays timed per session
+const char* const BENCH_PATH = "bench_seek.prs";
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// RECORD - random keys held a while; crashes just freeze the race for a
+// moment, the session carries on
+static void recordSession(int ticks, uint64_t seed) {
+    SessionWriter writer;
+    Simulation sim;
+    std::vector<Uint8> state;
+    sim.reset(seed, true);
+    writer.begin(BENCH_PATH, seed, 0);
+
+    unsigned keys = static_cast<unsigned>(seed);
+    char key = 0;
+    for(int t = 0; t < ticks; t++) {
+        if(t > 0 && t % KEYFRAME_INTERVAL == 0) {
+            state.clear();
+            sim.saveState(state);
+            writer.addKeyframe(state);
+        }
+        keys = keys * 1103515245u + 12345u;
+        if((keys >> 16) % 12 == 0) key = static_cast<char>((keys >> 20) % 5);
+        Uint8 input = makeTickInput(key, true);
+        writer.record(input);
+        sim.step(input);
+    }
+    writer.finish();
+}
+
+int main() {
+    const int MINUTES[4] = { 10, 40, 120, 240 };
+
+    std::printf("%8s %9s %9s | %8s | %9s %9s | %12s | %s\n", "minutes", "ticks", "file KB",
+                "open ms", "seek ms", "worst ms", "from-zero ms", "mismatches");
+    for(int m = 0; m < 4; m++) {
+        const int ticks = MINUTES[m] * 60 * FPS_TARGET;
+        recordSession(ticks, 2026 + m);
+
+        auto start = Clock::now();
+        SessionFile file;
+        if(!file.open(BENCH_PATH) || file.getTickCount() != ticks) {
+            std::printf("could not reopen %s\n", BENCH_PATH);
+            return 1;
+        }
+        double openMs = elapsedMs(start);
+
+        // SEEKS - random ticks, each checked against a from-zero replay below
+        Simulation sim;
+        std::vector<int> targets(BENCH_SEEKS);
+        std::vector<std::vector<Uint8> > states(BENCH_SEEKS);
+        unsigned r = 7919u + m;
+        double total = 0, worst = 0;
+        for(int s = 0; s < BENCH_SEEKS; s++) {
+            r = r * 1103515245u + 12345u;
+            targets[s] = static_cast<int>((static_cast<uint64_t>(r >> 8) * (ticks + 1)) >> 24);
+            start = Clock::now();
+            file.seek(targets[s], sim);
+            double ms = elapsedMs(start);
+            total += ms;
+            worst = std::max(worst, ms);
+            sim.saveState(states[s]);
+        }
+
+        // FROM ZERO - step the whole session once, comparing states on the way
+        SessionLog log;
+        log.load(BENCH_PATH);
+        std::vector<int> order(BENCH_SEEKS);
+        for(int s = 0; s < BENCH_SEEKS; s++) order[s] = s;
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return targets[a] < targets[b]; });
+
+        int mismatches = 0;
+        std::vector<Uint8> replayed;
+        sim.reset(log.getSeed(), false);
+        start = Clock::now();
+        for(int t = 0, next = 0; t <= ticks; t++) {
+            for(; next < BENCH_SEEKS && targets[order[next]] == t; next++) {
+                replayed.clear();
+                sim.saveState(replayed);
+                mismatches += replayed != states[order[next]];
+            }
+            if(t < ticks) sim.step(log.getInput(t));
+        }
+        double fullMs = elapsedMs(start);
+        for(int f = 1; f < BENCH_FULL_REPLAYS; f++) {
+            start = Clock::now();
+            file.seek(0, sim);
+            for(int t = 0; t < ticks; t++) sim.step(log.getInput(t));
+            fullMs = std::min(fullMs, elapsedMs(start));
+        }
+
+        std::printf("%8d %9d %9.1f | %8.3f | %9.3f %9.3f | %12.1f | %d\n", MINUTES[m], ticks,
+                    file.getSize() / 1024.0, openMs, total / BENCH_SEEKS, worst, fullMs, mismatches);
+    }
+    std::remove(BENCH_PATH);
+    std::printf("\nkeyframe every %d ticks\n", KEYFRAME_INTERVAL);
+    return 0;
+}
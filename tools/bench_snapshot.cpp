@@ -0,0 +1,110 @@
+//================================================================
+// bench_snapshot.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Game Snapshot Benchmark
+// Description: Times capturing and restoring whole-race snapshots in
+//              microseconds against a full reset, checks restored races
+//              play on identically, and counts heap allocations made by
+//              captures and restores after the first (should be 0)
+//================================================================
+
+#include "GameSnapshot.h"
+#include "AllocCounter.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+const int BENCH_RACES = 20;          // Races played (a lost race restarts on the next seed)
+const int BENCH_RACE_TICKS = FPS_TARGET * 60 * 2;
+const int BENCH_SNAPSHOT_EVERY = 500;   // Ticks between snapshots taken in a race
+const int BENCH_FOLLOW_TICKS = 600;  // Ticks the restored race is played on and compared
+const int BENCH_REPEATS = 2000;      // Timed repeats of each operation per snapshot
+const char* const BENCH_PATH = "bench_snapshot.prgs";
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// RANDOM DRIVER - keys held a while, in infinite mode so races run long
+static Uint8 nextInput(unsigned& keys, char& key) {
+    keys = keys * 1103515245u + 12345u;
+    if((keys >> 16) % 12 == 0) key = static_cast<char>((keys >> 20) % 5);
+    return makeTickInput(key, true);
+}
+
+int main() {
+    Simulation sim, restored;
+    GameSnapshot snapshot, reloaded;
+    std::vector<Uint8> expected, actual;
+    double captureUs = 0, restoreUs = 0, loadUs = 0, resetUs = 0;
+    long snapshots = 0, mismatches = 0, badFiles = 0, allocated = 0;
+
+    snapshot.capture(sim);   // First capture sizes the blob
+    for(int race = 0; race < BENCH_RACES; race++) {
+        sim.reset(1000 + race, true);
+        unsigned keys = 7919u + race;
+        char key = 0;
+        for(int t = 0; t < BENCH_RACE_TICKS; t++) {
+            TickEvents events = sim.step(nextInput(keys, key));
+            if(events.over) sim.reset(sim.getSeed() + BENCH_RACES, true);
+            if(t % BENCH_SNAPSHOT_EVERY != BENCH_SNAPSHOT_EVERY - 1) continue;
+
+            // TIMED - capture, restore (checksum plus load), load alone, reset
+            long before = allocations;
+            auto start = Clock::now();
+            for(int r = 0; r < BENCH_REPEATS; r++) snapshot.capture(sim);
+            captureUs += elapsedUs(start) / BENCH_REPEATS;
+
+            start = Clock::now();
+            for(int r = 0; r < BENCH_REPEATS; r++) snapshot.restore(restored);
+            restoreUs += elapsedUs(start) / BENCH_REPEATS;
+            allocated += allocations - before;
+
+            const Uint8* state = snapshot.getData() + SNAPSHOT_HEADER_BYTES;
+            size_t stateBytes = snapshot.getSize() - SNAPSHOT_HEADER_BYTES;
+            start = Clock::now();
+            for(int r = 0; r < BENCH_REPEATS; r++) restored.loadState(state, stateBytes);
+            loadUs += elapsedUs(start) / BENCH_REPEATS;
+
+            Simulation scratch;
+            start = Clock::now();
+            for(int r = 0; r < BENCH_REPEATS; r++) scratch.reset(race, true);
+            resetUs += elapsedUs(start) / BENCH_REPEATS;
+            snapshots++;
+
+            // ROUND TRIP THROUGH A FILE, THEN PLAY BOTH ON AND COMPARE
+            if(!snapshot.save(BENCH_PATH) || !reloaded.load(BENCH_PATH) || !reloaded.restore(restored)) {
+                badFiles++;
+                continue;
+            }
+            Simulation original = sim;
+            unsigned followKeys = keys;
+            char followKey = key;
+            for(int f = 0; f < BENCH_FOLLOW_TICKS; f++) {
+                Uint8 input = nextInput(followKeys, followKey);
+                original.step(input);
+                restored.step(input);
+            }
+            expected.clear();
+            actual.clear();
+            original.saveState(expected);
+            restored.saveState(actual);
+            mismatches += expected != actual;
+        }
+    }
+    std::remove(BENCH_PATH);
+
+    std::printf("state %zu bytes (+%d header), %ld snapshots over %d races\n\n",
+                snapshot.getSize() - SNAPSHOT_HEADER_BYTES, SNAPSHOT_HEADER_BYTES, snapshots, BENCH_RACES);
+    std::printf("%-28s %10s\n", "operation", "us");
+    std::printf("%-28s %10.3f\n", "capture", captureUs / snapshots);
+    std::printf("%-28s %10.3f\n", "restore (checksum + load)", restoreUs / snapshots);
+    std::printf("%-28s %10.3f\n", "load only", loadUs / snapshots);
+    std::printf("%-28s %10.3f\n", "reset", resetUs / snapshots);
+    std::printf("\nallocations in capture/restore: %ld\n", allocated);
+    std::printf("file round trips failed: %ld\n", badFiles);
+    std::printf("mismatches after %d ticks: %ld\n", BENCH_FOLLOW_TICKS, mismatches);
+    return mismatches || badFiles || allocated ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+//================================================================
+// bench_spatial.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Spatial Index Benchmark
+// Description: Times index rebuilds, blocked-lane queries, and player
+//              collision checks against full scans, up to 50,000
+//              AI cars and 50,000 obstacles
+//================================================================
+
+#include "EntityStore.h"
+#include "Collision.h"
+#include "Random.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+const int BENCH_QUERIES = 20000;   // Queries timed per measurement
+const int BENCH_SPACING = 8;       // Road pixels per entity of each kind
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// FULL SCANS - the pre-index behavior, kept here as the reference
+static bool scanLaneBlocked(const EntityStore& e, int lane, int y) {
+    for(int i = 0; i < e.getObstacleCount(); i++) {
+        if(std::abs(e.getObstacleX()[i] - LANE_X[lane]) <= e.getObstacleSize()[i] / 2 &&
+           e.getObstacleY()[i] > y && e.getObstacleY()[i] - y < AI_LANE_LOOKAHEAD) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int scanCollision(const EntityStore& e, point p) {
+    int half = SIZE / 2;
+    for(int i = 0; i < e.getAICount(); i++) {
+        // 64-bit squares: entities here can be far enough apart to overflow int
+        long long dx = p.x - e.getAIX()[i];
+        long long dy = p.y - e.getAIY()[i];
+        float distance = sqrt(static_cast<float>(dx * dx + dy * dy));
+        if(distance < half + SIZE / 2) return i;
+    }
+    for(int i = 0; i < e.getObstacleCount(); i++) {
+        int ox = e.getObstacleX()[i], oy = e.getObstacleY()[i], os = e.getObstacleSize()[i] / 2;
+        if(p.x + half > ox - os && p.x - half < ox + os && p.y + half > oy - os && p.y - half < oy + os) {
+            return e.getAICount() + i;
+        }
+    }
+    return -1;
+}
+
+int main() {
+    const int COUNTS[5] = { 10, 100, 1000, 10000, 50000 };
+    Random random(2026);
+    RandomScope scope(random);
+
+    std::printf("%8s %10s | %12s %12s | %12s %12s | %s\n", "entities", "rebuild us",
+                "lane scan ns", "lane index", "crash scan", "crash index", "mismatches");
+    for(int c = 0; c < 5; c++) {
+        const int n = COUNTS[c];
+        const int roadLength = std::max(COL, n * BENCH_SPACING);
+
+        EntityStore entities(n, n);
+        for(int i = 0; i < n; i++) entities.addAICar(COL - random.nextInt(roadLength), AI_BLUE);
+        for(int i = 0; i < n; i++) {
+            entities.addObstacle(ROAD_START + OBSTACLE_SPAWN_MIN_X_OFFSET +
+                                 random.nextInt(ROAD_WIDTH - OBSTACLE_SPAWN_MAX_X_OFFSET),
+                                 COL - random.nextInt(roadLength));
+        }
+
+        // REBUILD - one scroll tick of every obstacle plus the index
+        auto start = Clock::now();
+        const int ticks = std::max(1, 2000000 / n);
+        for(int t = 0; t < ticks; t++) entities.updateObstacles(t % 2 ? 1 : -1);
+        double rebuildUs = elapsedNs(start) / ticks / 1000.0;
+
+        // QUERY POINTS SPREAD OVER THE SAME ROAD
+        std::vector<int> lanes(BENCH_QUERIES), ys(BENCH_QUERIES);
+        std::vector<point> players(BENCH_QUERIES);
+        for(int q = 0; q < BENCH_QUERIES; q++) {
+            lanes[q] = random.nextInt(3);
+            ys[q] = COL - random.nextInt(roadLength);
+            players[q] = point(ROAD_START + random.nextInt(ROAD_WIDTH), COL - random.nextInt(roadLength));
+        }
+
+        int mismatches = 0;
+        long sink = 0;
+        start = Clock::now();
+        for(int q = 0; q < BENCH_QUERIES; q++) sink += scanLaneBlocked(entities, lanes[q], ys[q]);
+        double laneScan = elapsedNs(start) / BENCH_QUERIES;
+        start = Clock::now();
+        for(int q = 0; q < BENCH_QUERIES; q++) sink -= entities.isLaneBlocked(lanes[q], ys[q]);
+        double laneIndex = elapsedNs(start) / BENCH_QUERIES;
+        mismatches += sink != 0;
+
+        PlayerCar player(0, 0, PLAYER_CAR);
+        std::vector<int> scanned(BENCH_QUERIES);
+        start = Clock::now();
+        for(int q = 0; q < BENCH_QUERIES; q++) scanned[q] = scanCollision(entities, players[q]);
+        double crashScan = elapsedNs(start) / BENCH_QUERIES;
+
+        start = Clock::now();
+        for(int q = 0; q < BENCH_QUERIES; q++) {
+            bool hitAI, hitObstacle;
+            player = PlayerCar(players[q].x, players[q].y, PLAYER_CAR);
+            Collision::checkAllCollisions(player, entities, hitAI, hitObstacle);
+            sink += hitAI || hitObstacle;
+            if((hitAI || hitObstacle) != (scanned[q] >= 0)) mismatches++;
+        }
+        double crashIndex = elapsedNs(start) / BENCH_QUERIES;
+
+        std::printf("%8d %10.1f | %12.1f %12.1f | %12.1f %12.1f | %d\n",
+                    n, rebuildUs, laneScan, laneIndex, crashScan, crashIndex, mismatches);
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+//================================================================
+// render_session.cpp
+// Author: Jody Spikes, Hailey Pieper, Ian Dudley
+// Title: Offline Session Renderer
+// Description: Re-simulates a recorded race and renders every frame
+//              headlessly, with disjoint frame ranges rendered in
+//              parallel and written in order as raw RGB24 video
+//================================================================
+
+#include "SessionLog.h"
+#include "Simulation.h"
+#include "RaceRenderer.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// RENDERED CHUNK WAITING FOR ITS TURN TO BE WRITTEN
+struct RenderedChunk {
+    bool               ready;
+    std::vector<Uint8> rgb;
+
+    RenderedChunk() : ready{false} {}
+};
+
+// ADVANCE FROM THE NEAREST KEYFRAME TO A TICK WITHOUT DRAWING
+static void seekTo(const std::vector<Simulation>& keyframes, const SessionLog& log,
+                   int tick, Simulation& sim) {
+    sim = keyframes[tick / KEYFRAME_INTERVAL];
+    while(sim.getTick() < tick) sim.step(log.getInput(sim.getTick()));
+}
+
+// RENDER FRAMES [first, last) - frame f shows the race after tick f + 1
+static void renderChunk(const std::vector<Simulation>& keyframes, const SessionLog& log,
+                        int first, int last, std::vector<Uint8>& rgb) {
+    SDL_Plotter g(ROW, COL, false);
+    Simulation sim;
+    RaceRenderer race;
+    race.setNightMode((log.getFlags() & SESSION_NIGHT) != 0);
+
+    // WARM UP EFFECTS - older particles have all died by the first frame
+    int warmup = std::max(0, first - EFFECT_WARMUP_TICKS);
+    seekTo(keyframes, log, warmup, sim);
+    while(sim.getTick() < first) {
+        TickEvents events = sim.step(log.getInput(sim.getTick()));
+        race.onTick(sim, events);
+    }
+
+    const int width = g.getCol();
+    const int height = g.getRow();
+    rgb.resize(static_cast<size_t>(last - first) * width * height * 3);
+    Uint8* out = rgb.data();
+
+    for(int f = first; f < last; f++) {
+        TickEvents events = sim.step(log.getInput(f));
+        race.onTick(sim, events);
+        race.draw(g, sim);
+        g.update();
+
+        const Uint32* frame = g.getFrame();
+        for(int i = 0; i < width * height; i++) {
+            *out++ = static_cast<Uint8>(frame[i] >> 16);
+            *out++ = static_cast<Uint8>(frame[i] >> 8);
+            *out++ = static_cast<Uint8>(frame[i]);
+        }
+    }
+}
+
+static void usage() {
+    std::printf("usage: render_session <session.prs> <out.rgb> [--threads N] [--chunk FRAMES]\n");
+}
+
+int main(int argc, char** argv) {
+    if(argc < 3) {
+        usage();
+        return 1;
+    }
+
+    int threads = 0;
+    int chunkFrames = RENDER_CHUNK_FRAMES;
+    for(int i = 3; i + 1 < argc; i += 2) {
+        if(std::strcmp(argv[i], "--threads") == 0) threads = std::atoi(argv[i + 1]);
+        else if(std::strcmp(argv[i], "--chunk") == 0) chunkFrames = std::max(1, std::atoi(argv[i + 1]));
+        else {
+            usage();
+            return 1;
+        }
+    }
+
+    SessionLog log;
+    if(!log.load(argv[1])) {
+        std::printf("could not read session %s\n", argv[1]);
+        return 1;
+    }
+    FILE* video = std::fopen(argv[2], "wb");
+    if(!video) {
+        std::printf("could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    const int frames = log.getTickCount();
+    auto start = std::chrono::steady_clock::now();
+
+    // KEYFRAMES - one fast simulation pass, no drawing
+    std::vector<Simulation> keyframes;
+    Simulation sim;
+    sim.reset(log.getSeed(), false);
+    for(int tick = 0; tick <= frames; tick++) {
+        if(tick % KEYFRAME_INTERVAL == 0) keyframes.push_back(sim);
+        if(tick < frames) sim.step(log.getInput(tick));
+    }
+    auto keyed = std::chrono::steady_clock::now();
+
+    // RENDER CHUNKS IN PARALLEL, WRITE THEM IN FRAME ORDER
+    ThreadPool pool(threads);
+    const int chunks = (frames + chunkFrames - 1) / chunkFrames;
+    std::vector<RenderedChunk> rendered(chunks);
+    std::mutex writeLock;
+    int nextWrite = 0;
+    bool writeFailed = false;
+
+    pool.run(chunks, [&](int c) {
+        std::vector<Uint8> rgb;
+        renderChunk(keyframes, log, c * chunkFrames, std::min(frames, (c + 1) * chunkFrames), rgb);
+
+        std::lock_guard<std::mutex> guard(writeLock);
+        rendered[c].rgb.swap(rgb);
+        rendered[c].ready = true;
+        while(nextWrite < chunks && rendered[nextWrite].ready) {
+            std::vector<Uint8>& data = rendered[nextWrite].rgb;
+            if(std::fwrite(data.data(), 1, data.size(), video) != data.size()) writeFailed = true;
+            std::vector<Uint8>().swap(data);
+            nextWrite++;
+        }
+    });
+
+    if(std::fclose(video) != 0 || writeFailed) {
+        std::printf("error writing %s\n", argv[2]);
+        return 1;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double keyMs = std::chrono::duration<double, std::milli>(keyed - start).count();
+    double totalMs = std::chrono::duration<double, std::milli>(end - start).count();
+    double mb = static_cast<double>(frames) * ROW * COL * 3 / (1024.0 * 1024.0);
+    std::printf("%d frames, %d keyframes (%.1f ms), %d threads, %d-frame chunks\n",
+                frames, static_cast<int>(keyframes.size()), keyMs, pool.getThreadCount(), chunkFrames);
+    std::printf("rendered in %.1f ms: %.1f fps, %.1f MB/s\n",
+                totalMs, frames * 1000.0 / totalMs, mb * 1000.0 / totalMs);
+    std::printf("encode: ffmpeg -f rawvideo -pix_fmt rgb24 -s %dx%d -r %d -i %s out.mp4\n",
+                ROW, COL, 1000 / FRAME_DELAY_MS, argv[2]);
+    return 0;
+}